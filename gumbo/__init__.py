@@ -1,2 +1,3 @@
 from ._gumbo import *
 from .soup_adapter import *
+from .asyncio_adapter import *
@@ -0,0 +1,29 @@
+import asyncio
+from . import _gumbo
+
+__all__ = ['parse_async']
+
+
+def _set_result(future, output, error):
+    if future.cancelled():
+        return
+    if error is not None:
+        future.set_exception(error)
+    else:
+        future.set_result(output)
+
+
+async def parse_async(html, **options):
+    """
+    Parse HTML on a native thread pool without blocking the event loop.
+
+    Takes the same keyword arguments as parse, except visitor, visitor_tags and evict_tags.
+    """
+    loop = asyncio.get_running_loop()
+    future = loop.create_future()
+
+    def done(output, error):
+        loop.call_soon_threadsafe(_set_result, future, output, error)
+
+    _gumbo.parse_in_background(html, done, **options)
+    return await future
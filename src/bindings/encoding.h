@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace gumbo_python {
+
+  /// Checks whether an encoding name returned by normalize_encoding can be decoded
+  using EncodingCheck = std::function<bool(const std::string&)>;
+
+  /**
+   * Get the canonical WHATWG name ("utf-8", "utf-16le", "windows-1252", "shift_jis" and so on)
+   * for an encoding label. Labels that are not in the table are returned trimmed and lowercased.
+   */
+  std::string normalize_encoding(const std::string& label);
+
+  /// Get the encoding of a byte order mark at the start of data, empty if there is none
+  std::string sniff_bom(const char* data, size_t length, size_t& bom_length);
+
+  /**
+   * Determine the encoding of an HTML document with the WHATWG encoding sniffing algorithm:
+   * byte order mark, transport_encoding (the charset of the HTTP Content-Type header)
+   * and a <meta> prescan of the first 1024 bytes. Labels rejected by is_known are ignored.
+   * The fallback is UTF-8 rather than the locale-dependent default of browsers.
+   */
+  std::string sniff_encoding(const char* data, size_t length, const std::string& transport_encoding,
+    const EncodingCheck& is_known, size_t& bom_length);
+
+  /// True for the encodings that decode_to_utf8 handles
+  bool is_native_encoding(const std::string& encoding);
+
+  /// Get the length in bytes of text in a native encoding once it is decoded to UTF-8
+  size_t decoded_length(const std::string& encoding, const char* data, size_t length);
+
+  /**
+   * Decode text in UTF-16LE, UTF-16BE or a single-byte encoding (windows-1252, ISO-8859-x, KOI8-R
+   * and so on) to UTF-8. out must have room for decoded_length bytes. Invalid sequences and unmapped
+   * bytes are replaced with U+FFFD.
+   */
+  void decode_to_utf8(const std::string& encoding, const char* data, size_t length, char* out);
+
+  /// Get the Python codec that decodes a non-native encoding
+  std::string codec_name(const std::string& encoding);
+}
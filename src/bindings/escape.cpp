@@ -0,0 +1,115 @@
+#include "escape.h"
+
+#include <gumbo/char_ref.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    const uint64_t ones = 0x0101010101010101ull;
+    const uint64_t highs = 0x8080808080808080ull;
+
+    /// Non-zero if any byte of word equals c
+    inline uint64_t has_byte(uint64_t word, unsigned char c) {
+      uint64_t x = word ^ (ones * c);
+      return (x - ones) & ~x & highs;
+    }
+
+    inline bool is_escaped(char c, bool quote) {
+      return c == '&' || c == '<' || c == '>' || (quote && (c == '"' || c == '\''));
+    }
+
+    void append_utf8(int c, string& out) {
+      if (c < 0x80) {
+        out += static_cast<char>(c);
+      } else if (c < 0x800) {
+        out += static_cast<char>(0xC0 | (c >> 6));
+        out += static_cast<char>(0x80 | (c & 0x3F));
+      } else if (c < 0x10000) {
+        out += static_cast<char>(0xE0 | (c >> 12));
+        out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (c & 0x3F));
+      } else {
+        out += static_cast<char>(0xF0 | (c >> 18));
+        out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (c & 0x3F));
+      }
+    }
+  }
+
+  size_t find_escaped(const char* text, size_t length, bool quote) {
+    size_t i = 0;
+    // Skip 8 bytes at a time while none of them needs escaping
+    for (; i + 8 <= length; i += 8) {
+      uint64_t word;
+      memcpy(&word, text + i, 8);
+      uint64_t found = has_byte(word, '&') | has_byte(word, '<') | has_byte(word, '>');
+      if (quote)
+        found |= has_byte(word, '"') | has_byte(word, '\'');
+      if (found)
+        break;
+    }
+    for (; i < length; ++i) {
+      if (is_escaped(text[i], quote))
+        return i;
+    }
+    return length;
+  }
+
+  void escape_html(const char* text, size_t length, bool quote, string& out) {
+    const char* end = text + length;
+    while (text < end) {
+      size_t run = find_escaped(text, end - text, quote);
+      out.append(text, run);
+      text += run;
+      if (text == end)
+        break;
+      switch (*text) {
+      case '&':
+        out += "&amp;";
+        break;
+      case '<':
+        out += "&lt;";
+        break;
+      case '>':
+        out += "&gt;";
+        break;
+      case '"':
+        out += "&quot;";
+        break;
+      default:
+        out += "&#x27;";
+        break;
+      }
+      ++text;
+    }
+  }
+
+  void unescape_html(const char* text, size_t length, string& out) {
+    const char* end = text + length;
+    while (text < end) {
+      const char* amp = static_cast<const char*>(memchr(text, '&', end - text));
+      if (!amp) {
+        out.append(text, end);
+        break;
+      }
+      out.append(text, amp);
+      OneOrTwoCodepoints codepoints;
+      size_t consumed = decode_char_ref(amp, end - amp, &codepoints);
+      if (!consumed) {
+        out += '&';
+        text = amp + 1;
+        continue;
+      }
+      append_utf8(codepoints.first, out);
+      if (codepoints.second != kGumboNoChar)
+        append_utf8(codepoints.second, out);
+      text = amp + consumed;
+    }
+  }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace gumbo_python {
+
+  /// Get the offset of the first character that escape_html replaces, length if there is none
+  size_t find_escaped(const char* text, size_t length, bool quote);
+
+  /**
+   * Append text to out with &, < and > replaced by character references,
+   * and " and ' too if quote is true, like Python's html.escape.
+   */
+  void escape_html(const char* text, size_t length, bool quote, std::string& out);
+
+  /// Append UTF-8 text to out with character references decoded the way Gumbo decodes them in text
+  void unescape_html(const char* text, size_t length, std::string& out);
+}
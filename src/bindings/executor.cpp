@@ -0,0 +1,50 @@
+#include "executor.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace gumbo_python {
+  ThreadPool::ThreadPool(size_t threads)
+    : size_(threads ? threads : max(thread::hardware_concurrency(), 1u)) {}
+
+  void ThreadPool::run() {
+    for (;;) {
+      Task task;
+      {
+        unique_lock<mutex> lock(mutex_);
+        has_tasks_.wait(lock, [this] { return is_shut_down_ || !tasks_.empty(); });
+        if (tasks_.empty())
+          return;
+        task = move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  bool ThreadPool::submit(Task task) {
+    {
+      lock_guard<mutex> lock(mutex_);
+      if (is_shut_down_)
+        return false;
+      tasks_.push_back(move(task));
+      if (threads_.size() < size_)
+        threads_.emplace_back(&ThreadPool::run, this);
+    }
+    has_tasks_.notify_one();
+    return true;
+  }
+
+  void ThreadPool::shutdown() {
+    {
+      lock_guard<mutex> lock(mutex_);
+      is_shut_down_ = true;
+    }
+    has_tasks_.notify_all();
+    for (thread& worker : threads_) {
+      if (worker.joinable())
+        worker.join();
+    }
+  }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gumbo_python {
+
+  /// A fixed-size pool of native threads that run tasks in submission order
+  class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+  private:
+    size_t size_;
+    std::vector<std::thread> threads_;
+    std::deque<Task> tasks_;
+    std::mutex mutex_;
+    std::condition_variable has_tasks_;
+    bool is_shut_down_ = false;
+
+    void run();
+
+  public:
+    /// Threads are started lazily, 0 means one per CPU core
+    explicit ThreadPool(size_t threads = 0);
+
+    ~ThreadPool() { shutdown(); }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Queue a task. Returns false if the pool has been shut down.
+    bool submit(Task task);
+
+    /// Finish queued tasks and join the threads. Later submissions are refused.
+    void shutdown();
+  };
+}
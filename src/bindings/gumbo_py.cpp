@@ -26,8 +26,32 @@ PYBIND11_MODULE(_gumbo, m) {
     "GUMBO_ATTR_NAMESPACE_XMLNS",
     "ATTR_NAMESPACE_VALUES",
     "ATTR_NAMESPACE_URLS",
+    "GUMBO_TOKEN_DOCTYPE",
+    "GUMBO_TOKEN_START_TAG",
+    "GUMBO_TOKEN_END_TAG",
+    "GUMBO_TOKEN_COMMENT",
+    "GUMBO_TOKEN_WHITESPACE",
+    "GUMBO_TOKEN_CHARACTER",
+    "GUMBO_TOKEN_CDATA",
+    "GUMBO_TAG_UNKNOWN",
+    "GUMBO_STATUS_OK",
+    "GUMBO_STATUS_STOPPED",
+    "GUMBO_STATUS_TRUNCATED",
+    "GUMBO_STATUS_TREE_TOO_DEEP",
+    "GUMBO_STATUS_TOO_MANY_NODES",
+    "GUMBO_STATUS_CANCELLED",
     "parse",
-    "parse_fragment"
+    "parse_in_background",
+    "parse_fragment",
+    "Parser",
+    "set_background_destroy",
+    "set_cpu_count",
+    "Rewriter",
+    "tokenize",
+    "tag_name",
+    "tag_enum",
+    "escape",
+    "unescape"
   };
 
   m.attr("TAG_NAMESPACES") = tag_namespaces;
@@ -60,6 +84,29 @@ PYBIND11_MODULE(_gumbo, m) {
     .export_values()
     ;
 
+  py::enum_<GumboTokenType>(m, "GumboTokenType", py::arithmetic(), "Gumbo token types")
+    .value("GUMBO_TOKEN_DOCTYPE", GumboTokenType::GUMBO_TOKEN_DOCTYPE)
+    .value("GUMBO_TOKEN_START_TAG", GumboTokenType::GUMBO_TOKEN_START_TAG)
+    .value("GUMBO_TOKEN_END_TAG", GumboTokenType::GUMBO_TOKEN_END_TAG)
+    .value("GUMBO_TOKEN_COMMENT", GumboTokenType::GUMBO_TOKEN_COMMENT)
+    .value("GUMBO_TOKEN_WHITESPACE", GumboTokenType::GUMBO_TOKEN_WHITESPACE)
+    .value("GUMBO_TOKEN_CHARACTER", GumboTokenType::GUMBO_TOKEN_CHARACTER)
+    .value("GUMBO_TOKEN_CDATA", GumboTokenType::GUMBO_TOKEN_CDATA)
+    .export_values()
+    ;
+
+  py::enum_<GumboOutputStatus>(m, "GumboOutputStatus", py::arithmetic(), "Gumbo parse statuses")
+    .value("GUMBO_STATUS_OK", GumboOutputStatus::GUMBO_STATUS_OK)
+    .value("GUMBO_STATUS_STOPPED", GumboOutputStatus::GUMBO_STATUS_STOPPED)
+    .value("GUMBO_STATUS_TRUNCATED", GumboOutputStatus::GUMBO_STATUS_TRUNCATED)
+    .value("GUMBO_STATUS_TREE_TOO_DEEP", GumboOutputStatus::GUMBO_STATUS_TREE_TOO_DEEP)
+    .value("GUMBO_STATUS_TOO_MANY_NODES", GumboOutputStatus::GUMBO_STATUS_TOO_MANY_NODES)
+    .value("GUMBO_STATUS_CANCELLED", GumboOutputStatus::GUMBO_STATUS_CANCELLED)
+    .export_values()
+    ;
+
+  m.attr("GUMBO_TAG_UNKNOWN") = static_cast<int>(GUMBO_TAG_UNKNOWN);
+
   py::class_<NodeVector>(m, "NodeVector")
     .def("__iter__", &NodeVector::iter, py::return_value_policy::reference_internal)
     .def("__next__", &NodeVector::next)
@@ -89,6 +136,9 @@ PYBIND11_MODULE(_gumbo, m) {
     .def_property_readonly("type", &Node::type)
     .def_property_readonly("offset", &Node::offset)
     .def_property_readonly("index_within_parent", &Node::index_within_parent)
+    .def("get_text", &Node::get_text, py::arg("separator") = " ", py::arg("strip") = true,
+      py::arg("skip") = std::vector<std::string>{"script", "style", "noscript", "template"})
+    .def("to_html", &Node::to_html, py::arg("pretty") = false)
     .def("__str__", &Node::str)
     ;
 
@@ -109,6 +159,9 @@ PYBIND11_MODULE(_gumbo, m) {
     .def_property_readonly("tag_name", &Tag::tag_name)
     .def_property_readonly("attributes", &Tag::attributes)
     .def_property_readonly("tag_namespace", &Tag::tag_namespace)
+    .def("set_attribute", &Tag::set_attribute, py::arg("name"), py::arg("value"))
+    .def("remove_attribute", &Tag::remove_attribute, py::arg("name"))
+    .def("insert_text", &Tag::insert_text, py::arg("text"), py::arg("index") = -1)
     .def("__str__", &Tag::str)
     ;
 
@@ -120,10 +173,73 @@ PYBIND11_MODULE(_gumbo, m) {
   py::class_<Output>(m, "Output")
     .def_property_readonly("root", &Output::root)
     .def_property_readonly("document", &Output::document)
+    .def_property_readonly("status", &Output::status)
+    .def("links", &Output::links, py::arg("base_url") = py::none())
+    .def("position", &Output::position, py::arg("offset"))
+    .def("remove", &Output::remove, py::arg("node"))
+    .def("to_html", &Output::to_html, py::arg("pretty") = false, py::arg("preserve") = false)
+    ;
+
+  py::class_<Rewriter>(m, "Rewriter")
+    .def(py::init<>())
+    .def("set_attribute", &Rewriter::set_attribute, py::arg("selector"), py::arg("name"), py::arg("value"))
+    .def("remove_attribute", &Rewriter::remove_attribute, py::arg("selector"), py::arg("name"))
+    .def("rewrite_attribute", &Rewriter::rewrite_attribute, py::arg("selector"), py::arg("name"),
+      py::arg("callback"))
+    .def("remove", &Rewriter::remove, py::arg("selector"))
+    .def("before", &Rewriter::before, py::arg("selector"), py::arg("html"))
+    .def("after", &Rewriter::after, py::arg("selector"), py::arg("html"))
+    .def("rewrite", &Rewriter::rewrite, py::arg("html"), py::arg("write") = py::none())
+    ;
+
+  py::class_<TokenIterator>(m, "TokenIterator")
+    .def("__iter__", &TokenIterator::iter, py::return_value_policy::reference_internal)
+    .def("__next__", &TokenIterator::next)
     ;
 
-  m.def("parse", &parse);
+  m.def("tokenize", &tokenize, py::arg("html"));
+
+  m.def("tag_name", &tag_name, py::arg("tag"));
+
+  m.def("tag_enum", &tag_enum, py::arg("name"));
+
+  m.def("escape", &escape, py::arg("s"), py::arg("quote") = true);
+
+  m.def("unescape", &unescape, py::arg("s"));
+
+  m.def("parse", &parse,
+    py::arg("html"), py::arg("visitor") = py::none(), py::arg("visitor_tags") = py::none(),
+    py::arg("stop_after") = py::none(), py::arg("prune_tags") = py::none(),
+    py::arg("drop_whitespace") = false, py::arg("drop_comments") = false,
+    py::arg("max_tree_depth") = py::none(), py::arg("max_nodes") = py::none(),
+    py::arg("max_text_length") = py::none(), py::arg("max_attribute_length") = py::none(),
+    py::arg("max_attributes") = py::none(), py::arg("timeout") = py::none(),
+    py::arg("encoding") = py::none(), py::arg("transport_encoding") = py::none(),
+    py::arg("pipeline") = false, py::arg("chunk_size") = 0, py::arg("evict_tags") = py::none());
+
+  m.def("parse_in_background", &parse_in_background,
+    py::arg("html"), py::arg("done"), py::arg("stop_after") = py::none(),
+    py::arg("prune_tags") = py::none(), py::arg("drop_whitespace") = false,
+    py::arg("drop_comments") = false, py::arg("max_tree_depth") = py::none(),
+    py::arg("max_nodes") = py::none(), py::arg("max_text_length") = py::none(),
+    py::arg("max_attribute_length") = py::none(), py::arg("max_attributes") = py::none(),
+    py::arg("timeout") = py::none(), py::arg("encoding") = py::none(),
+    py::arg("transport_encoding") = py::none(), py::arg("pipeline") = false,
+    py::arg("chunk_size") = 0);
 
   m.def("parse_fragment", &parse_fragment,
     py::arg("html"), py::arg("container") = "div", py::arg("namespace") = "html");
+
+  m.def("set_background_destroy", &set_background_destroy, py::arg("enabled"));
+  m.def("set_cpu_count", &set_cpu_count, py::arg("count"));
+
+  py::class_<Parser>(m, "Parser")
+    .def(py::init<>())
+    .def("parse", &Parser::parse, py::arg("html"))
+    .def("parse_fragment", &Parser::parse_fragment,
+      py::arg("html"), py::arg("container") = "div", py::arg("namespace") = "html")
+    .def("reset", &Parser::reset)
+    ;
+
+  py::module::import("atexit").attr("register")(py::cpp_function(&shutdown_background_threads));
 }
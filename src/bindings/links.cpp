@@ -0,0 +1,393 @@
+#include "links.h"
+
+#include <utility>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    inline bool is_space(char c) {
+      return c == ' ' || c == '\n' || c == '\t' || c == '\f' || c == '\r';
+    }
+
+    inline bool is_alpha(char c) {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    inline bool is_digit(char c) {
+      return c >= '0' && c <= '9';
+    }
+
+    inline char to_lower(char c) {
+      return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+    }
+
+    bool equals_ignore_case(const char* a, const char* b) {
+      for (; *a && *b; ++a, ++b) {
+        if (to_lower(*a) != to_lower(*b))
+          return false;
+      }
+      return *a == *b;
+    }
+
+    /// A URI reference split into components as described in RFC 3986, appendix B
+    struct UriReference {
+      bool has_scheme = false;
+      bool has_authority = false;
+      bool has_query = false;
+      bool has_fragment = false;
+      string scheme;
+      string authority;
+      string path;
+      string query;
+      string fragment;
+    };
+
+    UriReference split_uri(const char* begin, const char* end) {
+      UriReference uri;
+      const char* p = begin;
+      if (p < end && is_alpha(*p)) {
+        const char* q = p + 1;
+        while (q < end && (is_alpha(*q) || is_digit(*q) || *q == '+' || *q == '-' || *q == '.'))
+          ++q;
+        if (q < end && *q == ':') {
+          uri.has_scheme = true;
+          for (const char* c = p; c < q; ++c)
+            uri.scheme += to_lower(*c);
+          p = q + 1;
+        }
+      }
+      if (end - p >= 2 && p[0] == '/' && p[1] == '/') {
+        p += 2;
+        const char* q = p;
+        while (q < end && *q != '/' && *q != '?' && *q != '#')
+          ++q;
+        uri.has_authority = true;
+        uri.authority.assign(p, q);
+        p = q;
+      }
+      const char* q = p;
+      while (q < end && *q != '?' && *q != '#')
+        ++q;
+      uri.path.assign(p, q);
+      p = q;
+      if (p < end && *p == '?') {
+        q = ++p;
+        while (q < end && *q != '#')
+          ++q;
+        uri.has_query = true;
+        uri.query.assign(p, q);
+        p = q;
+      }
+      if (p < end && *p == '#') {
+        uri.has_fragment = true;
+        uri.fragment.assign(p + 1, end);
+      }
+      return uri;
+    }
+
+    inline bool starts_with(const string& str, size_t pos, const char* prefix, size_t length) {
+      return str.compare(pos, length, prefix) == 0;
+    }
+
+    inline void remove_last_segment(string& output) {
+      size_t slash = output.rfind('/');
+      output.erase(slash == string::npos ? 0 : slash);
+    }
+
+    /// RFC 3986, section 5.2.4
+    string remove_dot_segments(const string& path) {
+      string output;
+      output.reserve(path.size());
+      size_t i = 0, n = path.size();
+      while (i < n) {
+        if (starts_with(path, i, "../", 3))
+          i += 3;
+        else if (starts_with(path, i, "./", 2))
+          i += 2;
+        else if (starts_with(path, i, "/./", 3))
+          i += 2;
+        else if (i + 2 == n && starts_with(path, i, "/.", 2)) {
+          output += '/';
+          i = n;
+        } else if (starts_with(path, i, "/../", 4)) {
+          i += 3;
+          remove_last_segment(output);
+        } else if (i + 3 == n && starts_with(path, i, "/..", 3)) {
+          remove_last_segment(output);
+          output += '/';
+          i = n;
+        } else if ((i + 1 == n && path[i] == '.') || (i + 2 == n && starts_with(path, i, "..", 2))) {
+          i = n;
+        } else {
+          size_t next = path.find('/', path[i] == '/' ? i + 1 : i);
+          if (next == string::npos)
+            next = n;
+          output.append(path, i, next - i);
+          i = next;
+        }
+      }
+      return output;
+    }
+
+    /// RFC 3986, section 5.2.3
+    string merge_paths(const UriReference& base, const string& path) {
+      if (base.has_authority && base.path.empty())
+        return "/" + path;
+      size_t slash = base.path.rfind('/');
+      if (slash == string::npos)
+        return path;
+      return base.path.substr(0, slash + 1) + path;
+    }
+
+    /// RFC 3986, section 5.3
+    string recompose(const UriReference& uri) {
+      string result;
+      result.reserve(uri.scheme.size() + uri.authority.size() + uri.path.size() +
+        uri.query.size() + uri.fragment.size() + 5);
+      if (uri.has_scheme) {
+        result += uri.scheme;
+        result += ':';
+      }
+      if (uri.has_authority) {
+        result += "//";
+        result += uri.authority;
+      }
+      result += uri.path;
+      if (uri.has_query) {
+        result += '?';
+        result += uri.query;
+      }
+      if (uri.has_fragment) {
+        result += '#';
+        result += uri.fragment;
+      }
+      return result;
+    }
+
+    /// Split the candidate URLs out of a srcset attribute value
+    void parse_srcset(const char* value, vector<string>& urls) {
+      const char* p = value;
+      while (true) {
+        while (*p && (is_space(*p) || *p == ','))
+          ++p;
+        if (!*p)
+          break;
+        const char* start = p;
+        while (*p && !is_space(*p))
+          ++p;
+        const char* end = p;
+        if (end[-1] == ',') {
+          while (end > start && end[-1] == ',')
+            --end;
+        } else {
+          // Skip descriptors, which may contain commas within parentheses
+          int depth = 0;
+          while (*p && (*p != ',' || depth > 0)) {
+            if (*p == '(')
+              ++depth;
+            else if (*p == ')' && depth > 0)
+              --depth;
+            ++p;
+          }
+        }
+        if (end > start)
+          urls.emplace_back(start, end);
+      }
+    }
+
+    /// Extract the URL from the content of <meta http-equiv="refresh">
+    bool parse_refresh(const char* content, string& url) {
+      const char* p = content;
+      while (is_space(*p))
+        ++p;
+      const char* time = p;
+      while (is_digit(*p) || *p == '.')
+        ++p;
+      if (p == time)
+        return false;
+      while (is_space(*p))
+        ++p;
+      if (*p == ';' || *p == ',')
+        ++p;
+      while (is_space(*p))
+        ++p;
+      if (!*p)
+        return false;
+      const char* saved = p;
+      if (to_lower(p[0]) == 'u' && to_lower(p[1]) == 'r' && to_lower(p[2]) == 'l') {
+        p += 3;
+        while (is_space(*p))
+          ++p;
+        if (*p == '=') {
+          ++p;
+          while (is_space(*p))
+            ++p;
+        } else {
+          p = saved;
+        }
+      }
+      const char* end;
+      if (*p == '"' || *p == '\'') {
+        char quote = *p++;
+        end = p;
+        while (*end && *end != quote)
+          ++end;
+      } else {
+        end = p;
+        while (*end)
+          ++end;
+        while (end > p && is_space(end[-1]))
+          --end;
+      }
+      if (end == p)
+        return false;
+      url.assign(p, end);
+      return true;
+    }
+
+    inline void add_link(vector<Link>& links, GumboTag tag, const GumboAttribute* attr,
+      string raw_url) {
+      links.push_back(Link{ tag, attr->name, move(raw_url), string(), false,
+        attr->value_start.offset });
+    }
+
+    void add_attribute_link(vector<Link>& links, GumboTag tag, const GumboVector* attributes,
+      const char* name) {
+      const GumboAttribute* attr = gumbo_get_attribute(attributes, name);
+      if (attr)
+        add_link(links, tag, attr, attr->value);
+    }
+
+    void collect_element_links(const GumboElement& element, vector<Link>& links,
+      const char** base_href) {
+      const GumboVector* attributes = &element.attributes;
+      switch (element.tag) {
+      case GUMBO_TAG_A:
+      case GUMBO_TAG_LINK:
+        add_attribute_link(links, element.tag, attributes, "href");
+        break;
+      case GUMBO_TAG_SCRIPT:
+      case GUMBO_TAG_IFRAME:
+        add_attribute_link(links, element.tag, attributes, "src");
+        break;
+      case GUMBO_TAG_FORM:
+        add_attribute_link(links, element.tag, attributes, "action");
+        break;
+      case GUMBO_TAG_IMG: {
+        add_attribute_link(links, element.tag, attributes, "src");
+        const GumboAttribute* srcset = gumbo_get_attribute(attributes, "srcset");
+        if (srcset) {
+          vector<string> urls;
+          parse_srcset(srcset->value, urls);
+          for (string& url : urls)
+            add_link(links, element.tag, srcset, move(url));
+        }
+        break;
+      }
+      case GUMBO_TAG_META: {
+        const GumboAttribute* http_equiv = gumbo_get_attribute(attributes, "http-equiv");
+        if (!http_equiv || !equals_ignore_case(http_equiv->value, "refresh"))
+          break;
+        const GumboAttribute* content = gumbo_get_attribute(attributes, "content");
+        string url;
+        if (content && parse_refresh(content->value, url))
+          add_link(links, element.tag, content, move(url));
+        break;
+      }
+      case GUMBO_TAG_BASE:
+        if (!*base_href) {
+          const GumboAttribute* href = gumbo_get_attribute(attributes, "href");
+          if (href)
+            *base_href = href->value;
+        }
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+  bool resolve_url(const string& base, const string& reference, string& result) {
+    const char* begin = reference.data();
+    const char* end = begin + reference.size();
+    while (begin < end && is_space(*begin))
+      ++begin;
+    while (end > begin && is_space(end[-1]))
+      --end;
+    UriReference ref = split_uri(begin, end);
+    UriReference target;
+    if (ref.has_scheme) {
+      target = move(ref);
+      target.path = remove_dot_segments(target.path);
+    } else {
+      UriReference base_uri = split_uri(base.data(), base.data() + base.size());
+      if (!base_uri.has_scheme)
+        return false;
+      target.has_scheme = true;
+      target.scheme = move(base_uri.scheme);
+      if (ref.has_authority) {
+        target.has_authority = true;
+        target.authority = move(ref.authority);
+        target.path = remove_dot_segments(ref.path);
+        target.has_query = ref.has_query;
+        target.query = move(ref.query);
+      } else {
+        if (ref.path.empty()) {
+          target.path = move(base_uri.path);
+          if (ref.has_query) {
+            target.has_query = true;
+            target.query = move(ref.query);
+          } else {
+            target.has_query = base_uri.has_query;
+            target.query = move(base_uri.query);
+          }
+        } else {
+          if (ref.path[0] == '/')
+            target.path = remove_dot_segments(ref.path);
+          else
+            target.path = remove_dot_segments(merge_paths(base_uri, ref.path));
+          target.has_query = ref.has_query;
+          target.query = move(ref.query);
+        }
+        target.has_authority = base_uri.has_authority;
+        target.authority = move(base_uri.authority);
+      }
+      target.has_fragment = ref.has_fragment;
+      target.fragment = move(ref.fragment);
+    }
+    result = recompose(target);
+    return true;
+  }
+
+  vector<Link> extract_links(const GumboNode* node, const string& base_url) {
+    vector<Link> links;
+    const char* base_href = nullptr;
+    vector<const GumboNode*> stack;
+    stack.push_back(node);
+    while (!stack.empty()) {
+      const GumboNode* current = stack.back();
+      stack.pop_back();
+      const GumboVector* children;
+      if (current->type == GUMBO_NODE_DOCUMENT) {
+        children = &current->v.document.children;
+      } else if (current->type == GUMBO_NODE_ELEMENT) {
+        if (current->v.element.tag_namespace == GUMBO_NAMESPACE_HTML)
+          collect_element_links(current->v.element, links, &base_href);
+        children = &current->v.element.children;
+      } else {
+        // Text nodes have no links and template contents are inert
+        continue;
+      }
+      for (size_t i = children->length; i > 0; --i)
+        stack.push_back(static_cast<const GumboNode*>(children->data[i - 1]));
+    }
+    string document_base;
+    if (!base_href || !resolve_url(base_url, base_href, document_base))
+      document_base = base_url;
+    for (Link& link : links)
+      link.is_resolved = resolve_url(document_base, link.raw_url, link.resolved_url);
+    return links;
+  }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <gumbo/gumbo.h>
+
+#include <string>
+#include <vector>
+
+namespace gumbo_python {
+
+  /// A URL found in a link or resource attribute
+  struct Link {
+    GumboTag tag;
+    const char* attribute;
+    std::string raw_url;
+    std::string resolved_url;
+    /// False if the URL is relative and there is no absolute base URL to resolve it against
+    bool is_resolved;
+    /// Offset of the attribute value in the source
+    size_t offset;
+  };
+
+  /**
+   * Resolve a URI reference against a base URI as described in RFC 3986, section 5.2.
+   * Leading and trailing whitespace of the reference is ignored.
+   * Returns false if the reference is relative and base is not an absolute URI.
+   */
+  bool resolve_url(const std::string& base, const std::string& reference, std::string& result);
+
+  /**
+   * Collect the URLs from a[href], link[href], img[src], img[srcset], script[src],
+   * iframe[src], form[action] and meta[http-equiv=refresh] elements in document order.
+   * URLs are resolved against the first <base href> of the document, which itself
+   * is resolved against base_url (if not empty).
+   */
+  std::vector<Link> extract_links(const GumboNode* node, const std::string& base_url);
+}
@@ -0,0 +1,539 @@
+#include "pipeline.h"
+
+#include <gumbo/pipeline.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    /// Tokens that the lexer thread may run ahead
+    const size_t ring_size = 1024;
+
+    /// Busy-wait iterations before a waiting thread goes to sleep
+    const int spin_limit = 1000;
+
+    /**
+     * The tree builder takes tokens about as fast as one lexer makes them, so more workers
+     * only hold more chunks in memory
+     */
+    const unsigned max_chunk_workers = 4;
+
+    /**
+     * A GumboLexer on its own thread that hands its tokens to the parsing thread through a
+     * single-producer single-consumer ring. A restart bumps the epoch, and the parsing thread
+     * drops the tokens of earlier epochs that are still in the ring. Either thread spins
+     * briefly when it has to wait for the other and then sleeps until it is woken. The lexer
+     * thread exits after the last token; a restart after that lexes on the parsing thread.
+     */
+    class LexerThread {
+    private:
+      struct Slot {
+        GumboLookaheadToken token;
+        unsigned epoch;
+      };
+
+      GumboLexer lexer_;
+      vector<Slot> ring_;
+      /// Written by the lexer thread
+      alignas(64) atomic<size_t> head_{0};
+      /// Written by the parsing thread
+      alignas(64) atomic<size_t> tail_{0};
+      alignas(64) atomic<unsigned> epoch_{0};
+      atomic<bool> is_stopping_{false};
+
+      // The request of the parsing thread for epoch_, read by the lexer thread after epoch_
+      // changes. It isn't changed again before a token of the new epoch arrives.
+      bool has_checkpoint_ = false;
+      GumboLexerCheckpoint checkpoint_;
+      GumboTokenizerEnum state_ = GUMBO_LEX_DATA;
+      bool is_current_node_foreign_ = false;
+
+      mutex mutex_;
+      /// Wakes the lexer thread when the ring has room, the epoch changes or it has to stop
+      condition_variable lexer_wake_;
+      /// Wakes the parsing thread when a token arrives
+      condition_variable parser_wake_;
+      // Set by a thread before it sleeps, so that the other one only locks mutex_ to wake it
+      atomic<bool> is_lexer_asleep_{false};
+      atomic<bool> is_parser_asleep_{false};
+      /// Set under mutex_ when the lexer thread is done with lexer_
+      bool has_exited_ = false;
+
+      // Used only by the parsing thread
+      size_t tail_position_ = 0;
+      size_t head_seen_ = 0;
+      /// The lexer thread has exited and lexer_ is used on this thread
+      bool is_inline_ = false;
+
+      thread thread_;
+
+      /// Wait until is_ready holds, spinning for a while before sleeping on wake
+      template <typename Predicate>
+      void wait(atomic<bool>& is_asleep, condition_variable& wake, Predicate is_ready) {
+        for (int spins = 0; spins < spin_limit; ++spins) {
+          if (is_ready())
+            return;
+        }
+        unique_lock<mutex> lock(mutex_);
+        // Sequentially consistent with the store of the other thread before it checks is_asleep
+        is_asleep.store(true);
+        wake.wait(lock, is_ready);
+        is_asleep.store(false, memory_order_relaxed);
+      }
+
+      /// Wake the other thread after a sequentially consistent store that it waits for
+      void notify(atomic<bool>& is_asleep, condition_variable& wake) {
+        if (is_asleep.load()) {
+          { lock_guard<mutex> lock(mutex_); }
+          wake.notify_one();
+        }
+      }
+
+      void run() {
+        unsigned epoch = 0;
+        size_t head = 0;
+        size_t tail_seen = 0;
+        // Nothing is lexed until start() sets the first epoch
+        wait(is_lexer_asleep_, lexer_wake_, [this] {
+          return is_stopping_.load() || epoch_.load() != 0;
+        });
+        while (!is_stopping_.load(memory_order_acquire)) {
+          unsigned requested = epoch_.load(memory_order_acquire);
+          if (requested != epoch) {
+            if (has_checkpoint_) {
+              gumbo_lexer_restart(&lexer_, &checkpoint_, state_, is_current_node_foreign_);
+            } else {
+              gumbo_lexer_set_state(&lexer_, state_, is_current_node_foreign_);
+            }
+            epoch = requested;
+          }
+          if (head - tail_seen == ring_size &&
+              head - (tail_seen = tail_.load(memory_order_acquire)) == ring_size) {
+            wait(is_lexer_asleep_, lexer_wake_, [this, head, epoch] {
+              return is_stopping_.load() || epoch_.load() != epoch ||
+                head - tail_.load() != ring_size;
+            });
+            continue;
+          }
+          Slot& slot = ring_[head % ring_size];
+          if (!gumbo_lexer_next_lookahead(&lexer_, &slot.token)) {
+            // Past the end of the input; exit unless a restart came in meanwhile
+            lock_guard<mutex> lock(mutex_);
+            if (epoch_.load() == epoch) {
+              has_exited_ = true;
+              return;
+            }
+            continue;
+          }
+          slot.epoch = epoch;
+          head_.store(++head);
+          notify(is_parser_asleep_, parser_wake_);
+        }
+      }
+
+    public:
+      LexerThread(const GumboOptions& options, const char* html, size_t length)
+        : ring_(ring_size) {
+        gumbo_lexer_init(&lexer_, &options, html, length);
+        try {
+          thread_ = thread(&LexerThread::run, this);
+        } catch (...) {
+          gumbo_lexer_destroy(&lexer_);
+          throw;
+        }
+      }
+
+      ~LexerThread() {
+        stop();
+        gumbo_lexer_destroy(&lexer_);
+      }
+
+      LexerThread(const LexerThread&) = delete;
+      LexerThread& operator=(const LexerThread&) = delete;
+
+      void start(GumboTokenizerEnum state) {
+        state_ = state;
+        epoch_.store(1);
+        notify(is_lexer_asleep_, lexer_wake_);
+      }
+
+      void next(GumboLookaheadToken& output) {
+        if (is_inline_) {
+          gumbo_lexer_next_lookahead(&lexer_, &output);
+          return;
+        }
+        unsigned epoch = epoch_.load(memory_order_relaxed);
+        for (;;) {
+          if (tail_position_ == head_seen_) {
+            head_seen_ = head_.load(memory_order_acquire);
+            if (tail_position_ == head_seen_) {
+              wait(is_parser_asleep_, parser_wake_, [this] {
+                return head_.load() != tail_position_;
+              });
+              continue;
+            }
+          }
+          Slot& slot = ring_[tail_position_ % ring_size];
+          bool is_current = slot.epoch == epoch;
+          if (is_current)
+            output = slot.token;
+          else
+            gumbo_lookahead_token_destroy(&slot.token);
+          tail_.store(++tail_position_);
+          notify(is_lexer_asleep_, lexer_wake_);
+          if (is_current)
+            return;
+        }
+      }
+
+      void restart(const GumboLexerCheckpoint& checkpoint, GumboTokenizerEnum state,
+        bool is_current_node_foreign) {
+        bool has_exited;
+        {
+          lock_guard<mutex> lock(mutex_);
+          has_exited = has_exited_;
+          if (!has_exited) {
+            has_checkpoint_ = true;
+            checkpoint_ = checkpoint;
+            state_ = state;
+            is_current_node_foreign_ = is_current_node_foreign;
+            epoch_.fetch_add(1);
+          }
+        }
+        if (!has_exited) {
+          notify(is_lexer_asleep_, lexer_wake_);
+          return;
+        }
+        // The lexer thread has stopped for good, so the rest of the tokens are lexed here
+        if (!is_inline_) {
+          thread_.join();
+          drop_tokens();
+          is_inline_ = true;
+        }
+        gumbo_lexer_restart(&lexer_, &checkpoint, state, is_current_node_foreign);
+      }
+
+      /// Join the lexer thread and free the tokens that were not taken
+      void stop() {
+        if (!thread_.joinable())
+          return;
+        is_stopping_.store(true);
+        notify(is_lexer_asleep_, lexer_wake_);
+        thread_.join();
+        drop_tokens();
+      }
+
+    private:
+      void drop_tokens() {
+        size_t head = head_.load(memory_order_acquire);
+        for (; tail_position_ != head; ++tail_position_)
+          gumbo_lookahead_token_destroy(&ring_[tail_position_ % ring_size].token);
+      }
+    };
+
+    /**
+     * Lexes a document in chunks on worker threads. Each chunk starts after a '>', and a worker
+     * lexes it as if the document started there. The parsing thread lexes the first chunk itself.
+     * Where the tokens before a chunk end exactly at its start with nothing carried over, it
+     * takes the tokens of the chunk. Where they don't, or where the tree builder disagrees with
+     * a token, it drops the rest of the chunk and lexes on by itself up to the next chunk.
+     */
+    class ChunkedLexer {
+    private:
+      enum ChunkStatus { pending, lexing, done, dropped };
+
+      struct Chunk {
+        const char* start;
+        GumboSourcePosition position;
+        /// A ChunkStatus. Whoever sees a chunk both done and dropped frees its tokens.
+        atomic<int> status{pending};
+        vector<GumboLookaheadToken> tokens;
+        /// Tokens moved to the parsing thread, which owns the rest once the chunk is done
+        size_t taken = 0;
+
+        // Where the worker stopped: at or after the start of the next chunk, between two tokens
+        const char* end_token_start = nullptr;
+        GumboLexerCheckpoint end;
+        GumboTokenizerEnum end_state = GUMBO_LEX_DATA;
+        bool is_end_foreign = false;
+        /// The worker stopped at the start of the next chunk in the state it is lexed in
+        bool ends_fresh = false;
+      };
+
+      const GumboOptions& options_;
+      const char* html_;
+      size_t length_;
+      unique_ptr<Chunk[]> chunks_;
+      size_t chunk_count_;
+      /// Chunks that the workers may lex ahead of the parsing thread
+      size_t window_;
+
+      // Used only by the parsing thread
+      GumboLexer lexer_;
+      /// The chunk of the next token
+      size_t chunk_ = 0;
+      /// Whether the next token comes from lexer_ rather than the tokens of chunk_
+      bool is_lexing_ = true;
+      /// lexer_, or the worker, where the parsing thread switched to the tokens of chunk_
+      GumboLexerCheckpoint handover_;
+
+      mutex mutex_;
+      condition_variable changed_;
+      /// chunk_ for the workers
+      size_t current_chunk_ = 0;
+      atomic<size_t> next_chunk_{1};
+      atomic<bool> is_stopping_{false};
+      vector<thread> workers_;
+
+      /**
+       * Start the chunks after a '>' followed by '<' or a line break, which is far more likely
+       * to end a tag than a '>' in a script, comment or attribute value
+       */
+      void split(size_t chunk_size, vector<const char*>& starts) const {
+        const char* end = html_ + length_;
+        starts.push_back(html_);
+        for (const char* next = html_ + chunk_size; next < end; next += chunk_size) {
+          const char* gt;
+          while ((gt = static_cast<const char*>(memchr(next, '>', end - next))) &&
+              gt + 1 < end && gt[1] != '<' && gt[1] != '\n')
+            next = gt + 1;
+          if (!gt || gt + 1 == end)
+            break;
+          next = gt + 1;
+          starts.push_back(next);
+        }
+      }
+
+      void free_tokens(Chunk& chunk) {
+        for (size_t i = chunk.taken; i < chunk.tokens.size(); ++i)
+          gumbo_lookahead_token_destroy(&chunk.tokens[i]);
+        vector<GumboLookaheadToken>().swap(chunk.tokens);
+        chunk.taken = 0;
+      }
+
+      void notify() {
+        { lock_guard<mutex> lock(mutex_); }
+        changed_.notify_all();
+      }
+
+      void lex(GumboLexer& lexer, Chunk& chunk, const char* next_start) {
+        gumbo_lexer_seek(&lexer, chunk.start, &chunk.position);
+        bool is_dropped = false;
+        GumboLookaheadToken token;
+        while (gumbo_lexer_next_lookahead(&lexer, &token)) {
+          chunk.tokens.push_back(token);
+          // Acquire, since the parsing thread reads chunk.taken before it drops the chunk
+          if (chunk.status.load(memory_order_acquire) == dropped ||
+              is_stopping_.load(memory_order_relaxed)) {
+            is_dropped = true;
+            break;
+          }
+          if (next_start && token.next_token_start >= next_start &&
+              gumbo_lexer_save(&lexer, &chunk.end)) {
+            chunk.end_token_start = token.next_token_start;
+            chunk.end_state = gumbo_lexer_get_state(&lexer);
+            chunk.is_end_foreign = gumbo_lexer_in_foreign_content(&lexer);
+            chunk.ends_fresh = token.next_token_start == next_start &&
+              gumbo_lexer_is_at_fresh_token(&lexer);
+            break;
+          }
+        }
+        int status = lexing;
+        if (is_dropped || !chunk.status.compare_exchange_strong(status, done))
+          free_tokens(chunk);
+        notify();
+      }
+
+      void work() {
+        GumboLexer lexer;
+        gumbo_lexer_init(&lexer, &options_, html_, length_);
+        for (size_t index; (index = next_chunk_.fetch_add(1)) < chunk_count_;) {
+          {
+            unique_lock<mutex> lock(mutex_);
+            changed_.wait(lock, [&] { return is_stopping_ || index <= current_chunk_ + window_; });
+          }
+          if (is_stopping_)
+            break;
+          int status = pending;
+          if (chunks_[index].status.compare_exchange_strong(status, lexing))
+            lex(lexer, chunks_[index], index + 1 < chunk_count_ ? chunks_[index + 1].start : nullptr);
+        }
+        gumbo_lexer_destroy(&lexer);
+      }
+
+      void set_chunk(size_t index) {
+        chunk_ = index;
+        {
+          lock_guard<mutex> lock(mutex_);
+          current_chunk_ = index;
+        }
+        changed_.notify_all();
+      }
+
+      void drop(Chunk& chunk) {
+        if (chunk.status.exchange(dropped) == done)
+          free_tokens(chunk);
+      }
+
+      /// Drop the chunks that lexer_ has lexed into, or switch to the next one if it can
+      void follow_lexer(const char* next_token_start) {
+        while (chunk_ + 1 < chunk_count_ && chunks_[chunk_ + 1].start <= next_token_start) {
+          if (chunks_[chunk_ + 1].start == next_token_start &&
+              gumbo_lexer_is_at_fresh_token(&lexer_)) {
+            gumbo_lexer_save(&lexer_, &handover_);
+            is_lexing_ = false;
+            set_chunk(chunk_ + 1);
+            return;
+          }
+          drop(chunks_[chunk_ + 1]);
+          set_chunk(chunk_ + 1);
+        }
+      }
+
+    public:
+      ChunkedLexer(const GumboOptions& options, const char* html, size_t length,
+        size_t chunk_size, unsigned workers)
+        : options_(options), html_(html), length_(length), window_(workers) {
+        vector<const char*> starts;
+        split(chunk_size, starts);
+        chunk_count_ = starts.size();
+        chunks_.reset(new Chunk[chunk_count_]);
+        GumboLineIndex* line_index = options.track_line_column ?
+          gumbo_create_line_index(&options, html, length) : nullptr;
+        for (size_t i = 0; i < chunk_count_; ++i) {
+          Chunk& chunk = chunks_[i];
+          chunk.start = starts[i];
+          chunk.position.line = 0;
+          chunk.position.column = 0;
+          chunk.position.offset = starts[i] - html;
+          if (line_index)
+            gumbo_compute_position(line_index, &chunk.position);
+        }
+        if (line_index)
+          gumbo_destroy_line_index(line_index);
+        gumbo_lexer_init(&lexer_, &options, html, length);
+        try {
+          for (unsigned i = 0; i < workers && i + 1 < chunk_count_; ++i)
+            workers_.emplace_back(&ChunkedLexer::work, this);
+        } catch (...) {
+          stop();
+          gumbo_lexer_destroy(&lexer_);
+          throw;
+        }
+      }
+
+      ~ChunkedLexer() {
+        stop();
+        gumbo_lexer_destroy(&lexer_);
+      }
+
+      ChunkedLexer(const ChunkedLexer&) = delete;
+      ChunkedLexer& operator=(const ChunkedLexer&) = delete;
+
+      void start(GumboTokenizerEnum state) {
+        gumbo_lexer_set_state(&lexer_, state, false);
+      }
+
+      void next(GumboLookaheadToken& output) {
+        for (;;) {
+          if (is_lexing_) {
+            gumbo_lexer_next_lookahead(&lexer_, &output);
+            follow_lexer(output.next_token_start);
+            return;
+          }
+          Chunk& chunk = chunks_[chunk_];
+          if (chunk.status.load(memory_order_acquire) != done) {
+            unique_lock<mutex> lock(mutex_);
+            changed_.wait(lock, [&] { return chunk.status.load(memory_order_acquire) == done; });
+          }
+          if (chunk.taken < chunk.tokens.size()) {
+            output = chunk.tokens[chunk.taken++];
+            return;
+          }
+          free_tokens(chunk);
+          if (chunk.ends_fresh) {
+            handover_ = chunk.end;
+            set_chunk(chunk_ + 1);
+            continue;
+          }
+          gumbo_lexer_restart(&lexer_, &chunk.end, chunk.end_state, chunk.is_end_foreign);
+          is_lexing_ = true;
+          follow_lexer(chunk.end_token_start);
+        }
+      }
+
+      void restart(const GumboLexerCheckpoint& checkpoint, GumboTokenizerEnum state,
+        bool is_current_node_foreign) {
+        const GumboLexerCheckpoint* from = &checkpoint;
+        if (!is_lexing_) {
+          Chunk& chunk = chunks_[chunk_];
+          if (!chunk.taken) {
+            // The rejected token came before the chunk
+            drop(chunk);
+          } else {
+            // The first token of a chunk has no last start tag for the appropriate end tag
+            if (chunk.taken == 1)
+              from = &handover_;
+            free_tokens(chunk);
+          }
+          is_lexing_ = true;
+        }
+        gumbo_lexer_restart(&lexer_, from, state, is_current_node_foreign);
+      }
+
+      /// Join the workers and free the tokens that were not taken
+      void stop() {
+        if (is_stopping_.exchange(true))
+          return;
+        notify();
+        for (thread& worker : workers_)
+          worker.join();
+        for (size_t i = 0; i < chunk_count_; ++i) {
+          if (chunks_[i].status.load(memory_order_acquire) == done)
+            free_tokens(chunks_[i]);
+        }
+      }
+    };
+
+    template <typename Lexer>
+    GumboTokenPipeline make_pipeline(Lexer& lexer) {
+      GumboTokenPipeline pipeline;
+      pipeline.start = [](void* self, GumboTokenizerEnum state) {
+        static_cast<Lexer*>(self)->start(state);
+      };
+      pipeline.next = [](void* self, GumboLookaheadToken* output) {
+        static_cast<Lexer*>(self)->next(*output);
+      };
+      pipeline.restart = [](void* self, const GumboLexerCheckpoint* checkpoint,
+        GumboTokenizerEnum state, bool is_current_node_foreign) {
+        static_cast<Lexer*>(self)->restart(*checkpoint, state, is_current_node_foreign);
+      };
+      pipeline.stop = [](void* self) { static_cast<Lexer*>(self)->stop(); };
+      pipeline.userdata = &lexer;
+      return pipeline;
+    }
+  }
+
+  GumboOutput* parse_pipelined(const GumboOptions& options, const char* html, size_t length) {
+    LexerThread lexer(options, html, length);
+    GumboTokenPipeline pipeline = make_pipeline(lexer);
+    return gumbo_parse_pipelined(&options, html, length, &pipeline);
+  }
+
+  GumboOutput* parse_chunked(const GumboOptions& options, const char* html, size_t length,
+    size_t chunk_size, unsigned workers) {
+    ChunkedLexer lexer(options, html, length, chunk_size, max(1u, min(workers, max_chunk_workers)));
+    GumboTokenPipeline pipeline = make_pipeline(lexer);
+    return gumbo_parse_pipelined(&options, html, length, &pipeline);
+  }
+}
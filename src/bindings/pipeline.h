@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gumbo/gumbo.h>
+
+#include <cstddef>
+
+namespace gumbo_python {
+
+  /**
+   * Same as gumbo_parse_with_options, with the tokenizer running ahead of the tree builder
+   * on a second thread. The two threads overlap on large documents; for small ones
+   * starting the thread costs more than it saves. Options callbacks run on the calling thread.
+   */
+  GumboOutput* parse_pipelined(const GumboOptions& options, const char* html, size_t length);
+
+  /**
+   * Same as parse_pipelined, with the document split into chunks of about chunk_size bytes
+   * that up to workers threads tokenize in parallel, each from the start of a token after a '>'.
+   * A chunk is tokenized again on the calling thread where that guess was wrong, e.g. in
+   * a comment or script. Tokens take some 240 bytes per character while they wait for the tree
+   * builder, so chunks of a few dozen kilobytes keep the workers ahead with little memory.
+   */
+  GumboOutput* parse_chunked(const GumboOptions& options, const char* html, size_t length,
+    size_t chunk_size, unsigned workers);
+}
@@ -0,0 +1,681 @@
+#include "rewriter.h"
+
+#include "serializer.h"
+#include "text.h"
+
+#include <gumbo/lexer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    TagSet tag_set_of(initializer_list<GumboTag> tags) {
+      TagSet tag_set;
+      for (GumboTag tag : tags)
+        tag_set.set(tag);
+      return tag_set;
+    }
+
+    /// Start tags that close an open <p> element
+    const TagSet paragraph_closers = tag_set_of({
+      GUMBO_TAG_ADDRESS, GUMBO_TAG_ARTICLE, GUMBO_TAG_ASIDE, GUMBO_TAG_BLOCKQUOTE,
+      GUMBO_TAG_CENTER, GUMBO_TAG_DD, GUMBO_TAG_DETAILS, GUMBO_TAG_DIR,
+      GUMBO_TAG_DIV, GUMBO_TAG_DL, GUMBO_TAG_DT, GUMBO_TAG_FIELDSET, GUMBO_TAG_FIGCAPTION,
+      GUMBO_TAG_FIGURE, GUMBO_TAG_FOOTER, GUMBO_TAG_FORM, GUMBO_TAG_H1, GUMBO_TAG_H2,
+      GUMBO_TAG_H3, GUMBO_TAG_H4, GUMBO_TAG_H5, GUMBO_TAG_H6, GUMBO_TAG_HEADER,
+      GUMBO_TAG_HGROUP, GUMBO_TAG_HR, GUMBO_TAG_LI, GUMBO_TAG_LISTING, GUMBO_TAG_MAIN,
+      GUMBO_TAG_MENU, GUMBO_TAG_NAV, GUMBO_TAG_OL, GUMBO_TAG_P, GUMBO_TAG_PLAINTEXT,
+      GUMBO_TAG_PRE, GUMBO_TAG_SECTION, GUMBO_TAG_SUMMARY, GUMBO_TAG_TABLE, GUMBO_TAG_UL,
+      GUMBO_TAG_XMP });
+
+    const TagSet headings = tag_set_of({
+      GUMBO_TAG_H1, GUMBO_TAG_H2, GUMBO_TAG_H3, GUMBO_TAG_H4, GUMBO_TAG_H5, GUMBO_TAG_H6 });
+
+    /// Elements that bound the search for an open element to close implicitly
+    const TagSet scope_boundaries = tag_set_of({
+      GUMBO_TAG_APPLET, GUMBO_TAG_CAPTION, GUMBO_TAG_HTML, GUMBO_TAG_TABLE, GUMBO_TAG_TD,
+      GUMBO_TAG_TH, GUMBO_TAG_MARQUEE, GUMBO_TAG_OBJECT, GUMBO_TAG_TEMPLATE });
+
+    const TagSet button_scope_boundaries = scope_boundaries | tag_set_of({ GUMBO_TAG_BUTTON });
+
+    const TagSet list_item_boundaries = scope_boundaries | tag_set_of({ GUMBO_TAG_OL, GUMBO_TAG_UL });
+
+    const TagSet table_boundaries = tag_set_of({ GUMBO_TAG_HTML, GUMBO_TAG_TABLE, GUMBO_TAG_TEMPLATE });
+
+    inline bool is_space(char c) {
+      return c == ' ' || c == '\n' || c == '\t' || c == '\f' || c == '\r';
+    }
+
+    inline char to_lower(char c) {
+      return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+    }
+
+    inline bool in_set(const TagSet& tags, GumboTag tag) {
+      return tag < GUMBO_TAG_LAST && tags.test(tag);
+    }
+
+    inline bool is_identifier_char(char c) {
+      return c && !is_space(c) && !strchr("#.[]=,*\"'", c);
+    }
+
+    class SelectorParser {
+    private:
+      const string& text_;
+      const char* p_;
+
+      [[noreturn]] void fail() const {
+        throw invalid_argument("invalid selector: '" + text_ + "'");
+      }
+
+      void skip_spaces() {
+        while (is_space(*p_))
+          ++p_;
+      }
+
+      string identifier(bool lowercase) {
+        const char* start = p_;
+        while (is_identifier_char(*p_))
+          ++p_;
+        if (p_ == start)
+          fail();
+        string result(start, p_);
+        if (lowercase)
+          transform(result.begin(), result.end(), result.begin(), to_lower);
+        return result;
+      }
+
+      void attribute_condition(Selector& selector) {
+        skip_spaces();
+        Selector::AttributeCondition condition{ identifier(true), false, string() };
+        skip_spaces();
+        if (*p_ == '=') {
+          ++p_;
+          skip_spaces();
+          condition.has_value = true;
+          if (*p_ == '"' || *p_ == '\'') {
+            const char* end = strchr(p_ + 1, *p_);
+            if (!end)
+              fail();
+            condition.value.assign(p_ + 1, end);
+            p_ = end + 1;
+          } else {
+            condition.value = identifier(false);
+          }
+          skip_spaces();
+        }
+        if (*p_ != ']')
+          fail();
+        ++p_;
+        selector.attributes.push_back(move(condition));
+      }
+
+      Selector compound() {
+        Selector selector;
+        bool is_empty = true;
+        if (*p_ == '*') {
+          ++p_;
+          is_empty = false;
+        } else if (is_identifier_char(*p_)) {
+          string name = identifier(true);
+          selector.tag = gumbo_tagn_enum(name.data(), static_cast<int>(name.size()));
+          if (selector.tag == GUMBO_TAG_UNKNOWN)
+            selector.tag_name = move(name);
+          is_empty = false;
+        }
+        while (true) {
+          if (*p_ == '#') {
+            ++p_;
+            selector.attributes.push_back({ "id", true, identifier(false) });
+          } else if (*p_ == '.') {
+            ++p_;
+            selector.classes.push_back(identifier(false));
+          } else if (*p_ == '[') {
+            ++p_;
+            attribute_condition(selector);
+          } else {
+            break;
+          }
+          is_empty = false;
+        }
+        if (is_empty)
+          fail();
+        return selector;
+      }
+
+    public:
+      explicit SelectorParser(const string& text) : text_(text), p_(text.c_str()) {}
+
+      vector<Selector> parse() {
+        vector<Selector> selectors;
+        while (true) {
+          skip_spaces();
+          selectors.push_back(compound());
+          skip_spaces();
+          if (!*p_)
+            return selectors;
+          if (*p_ != ',')
+            fail();
+          ++p_;
+        }
+      }
+    };
+
+    /// Lowercase name of a start or end tag from its original text
+    string tag_name_of(const GumboStringPiece& original_text) {
+      const char* p = original_text.data + 1;
+      const char* end = original_text.data + original_text.length;
+      if (p < end && *p == '/')
+        ++p;
+      string name;
+      for (; p < end && !is_space(*p) && *p != '/' && *p != '>'; ++p)
+        name += to_lower(*p);
+      return name;
+    }
+
+    /// An attribute in the original text of a start tag
+    struct RawAttribute {
+      const char* start;
+      const char* name_end;
+      const char* end;
+    };
+
+    /**
+     * Split the original text of a start tag into attributes like the tokenizer does. Unlike the
+     * token, the result keeps duplicates, which the tokenizer drops but a browser may still see.
+     */
+    vector<RawAttribute> raw_attributes_of(const GumboStringPiece& original_text) {
+      const char* p = original_text.data + 1;
+      const char* end = original_text.data + original_text.length;
+      while (p < end && !is_space(*p) && *p != '/' && *p != '>')
+        ++p;
+      vector<RawAttribute> attributes;
+      while (true) {
+        while (p < end && (is_space(*p) || *p == '/'))
+          ++p;
+        if (p >= end || *p == '>')
+          return attributes;
+        RawAttribute attribute;
+        attribute.start = p;
+        // A name may start with '='
+        for (++p; p < end && !is_space(*p) && *p != '/' && *p != '>' && *p != '='; ++p) {}
+        attribute.name_end = p;
+        const char* value = p;
+        while (value < end && is_space(*value))
+          ++value;
+        if (value < end && *value == '=') {
+          for (++value; value < end && is_space(*value); ++value) {}
+          if (value < end && (*value == '"' || *value == '\'')) {
+            const void* quote = memchr(value + 1, *value, end - value - 1);
+            p = quote ? static_cast<const char*>(quote) + 1 : end;
+          } else {
+            for (p = value; p < end && !is_space(*p) && *p != '>'; ++p) {}
+          }
+        }
+        attribute.end = p;
+        attributes.push_back(attribute);
+      }
+    }
+
+    bool has_class(const char* classes, const string& name) {
+      const char* p = classes;
+      while (*p) {
+        while (is_space(*p))
+          ++p;
+        const char* start = p;
+        while (*p && !is_space(*p))
+          ++p;
+        if (static_cast<size_t>(p - start) == name.size() && !memcmp(start, name.data(), name.size()))
+          return true;
+      }
+      return false;
+    }
+
+    bool matches(const Selector& selector, GumboTag tag, const string& tag_name,
+      const GumboVector* attributes) {
+      if (selector.tag != GUMBO_TAG_LAST) {
+        if (selector.tag != tag || (tag == GUMBO_TAG_UNKNOWN && selector.tag_name != tag_name))
+          return false;
+      }
+      for (const Selector::AttributeCondition& condition : selector.attributes) {
+        const GumboAttribute* attr = gumbo_get_attribute(attributes, condition.name.c_str());
+        if (!attr || (condition.has_value && condition.value != attr->value))
+          return false;
+      }
+      if (!selector.classes.empty()) {
+        const GumboAttribute* attr = gumbo_get_attribute(attributes, "class");
+        if (!attr)
+          return false;
+        for (const string& name : selector.classes) {
+          if (!has_class(attr->value, name))
+            return false;
+        }
+      }
+      return true;
+    }
+
+    bool matches_any(const vector<Selector>& selectors, GumboTag tag, const string& tag_name,
+      const GumboVector* attributes) {
+      for (const Selector& selector : selectors) {
+        if (matches(selector, tag, tag_name, attributes))
+          return true;
+      }
+      return false;
+    }
+
+    void append_attribute(string& html, const char* name, size_t name_length, const string& value) {
+      html.append(name, name_length);
+      html += "=\"";
+      for (char c : value) {
+        if (c == '&')
+          html += "&amp;";
+        else if (c == '"')
+          html += "&quot;";
+        else
+          html += c;
+      }
+      html += '"';
+    }
+
+    /// Pending change to an attribute of the current start tag
+    struct AttributeEdit {
+      string name;
+      bool is_removed;
+      string value;
+      bool is_applied;
+    };
+
+    class LexerHandle {
+    private:
+      GumboLexer lexer_;
+
+    public:
+      LexerHandle(const GumboOptions* options, const char* html, size_t length) {
+        gumbo_lexer_init(&lexer_, options, html, length);
+      }
+
+      ~LexerHandle() { gumbo_lexer_destroy(&lexer_); }
+
+      LexerHandle(const LexerHandle&) = delete;
+      LexerHandle& operator=(const LexerHandle&) = delete;
+
+      GumboLexer* get() { return &lexer_; }
+    };
+
+    class TokenHandle {
+    private:
+      GumboToken* token_;
+
+    public:
+      explicit TokenHandle(GumboToken* token) : token_(token) {}
+
+      ~TokenHandle() { gumbo_token_destroy(token_); }
+
+      TokenHandle(const TokenHandle&) = delete;
+      TokenHandle& operator=(const TokenHandle&) = delete;
+    };
+
+    /// State of a single StreamRewriter::rewrite call
+    class Rewrite {
+    private:
+      struct OpenElement {
+        GumboTag tag;
+        /// Lowercase name for tags unknown to Gumbo
+        string name;
+        vector<const string*> after;
+      };
+
+      const vector<StreamRewriter::Rule>& rules_;
+      const char* source_;
+      const StreamRewriter::Sink* sink_;
+      size_t chunk_size_;
+      string html_;
+      /// Source before this offset has been written or skipped
+      size_t copied_ = 0;
+      vector<OpenElement> open_elements_;
+      /// Stack size while a removed element is open, 0 otherwise
+      size_t removed_depth_ = 0;
+
+      void write(const char* data, size_t length) {
+        html_.append(data, length);
+        if (sink_ && html_.size() >= chunk_size_) {
+          (*sink_)(html_.data(), html_.size());
+          html_.clear();
+        }
+      }
+
+      void write(const string& html) { write(html.data(), html.size()); }
+
+      void copy_source(size_t offset) {
+        if (offset <= copied_)
+          return;
+        size_t length = offset - copied_;
+        if (sink_ && html_.empty() && length >= chunk_size_)
+          (*sink_)(source_ + copied_, length);
+        else
+          write(source_ + copied_, length);
+        copied_ = offset;
+      }
+
+      size_t offset_of(const char* p) const { return p - source_; }
+
+      /// Pop open elements down to size, closing them at offset
+      void close_elements(size_t size, size_t offset) {
+        while (open_elements_.size() > size) {
+          if (removed_depth_ == open_elements_.size()) {
+            copied_ = offset;
+            removed_depth_ = 0;
+          }
+          if (!removed_depth_ && !open_elements_.back().after.empty()) {
+            copy_source(offset);
+            for (const string* html : open_elements_.back().after)
+              write(*html);
+          }
+          open_elements_.pop_back();
+        }
+      }
+
+      /// Close the innermost open element in targets unless an element in boundaries is found first
+      void close_until(const TagSet& targets, const TagSet& boundaries, size_t offset) {
+        for (size_t i = open_elements_.size(); i > 0; --i) {
+          GumboTag tag = open_elements_[i - 1].tag;
+          if (in_set(targets, tag)) {
+            close_elements(i - 1, offset);
+            return;
+          }
+          if (in_set(boundaries, tag))
+            return;
+        }
+      }
+
+      void close_top(GumboTag tag, size_t offset) {
+        if (!open_elements_.empty() && open_elements_.back().tag == tag)
+          close_elements(open_elements_.size() - 1, offset);
+      }
+
+      /// Close elements whose end tag is implied by an HTML start tag
+      void close_implied(GumboTag tag, size_t offset) {
+        if (in_set(paragraph_closers, tag))
+          close_until(tag_set_of({ GUMBO_TAG_P }), button_scope_boundaries, offset);
+        switch (tag) {
+        case GUMBO_TAG_LI:
+          close_until(tag_set_of({ GUMBO_TAG_LI }), list_item_boundaries, offset);
+          break;
+        case GUMBO_TAG_DD:
+        case GUMBO_TAG_DT:
+          close_until(tag_set_of({ GUMBO_TAG_DD, GUMBO_TAG_DT }),
+            scope_boundaries | tag_set_of({ GUMBO_TAG_DL }), offset);
+          break;
+        case GUMBO_TAG_H1:
+        case GUMBO_TAG_H2:
+        case GUMBO_TAG_H3:
+        case GUMBO_TAG_H4:
+        case GUMBO_TAG_H5:
+        case GUMBO_TAG_H6:
+          if (!open_elements_.empty() && in_set(headings, open_elements_.back().tag))
+            close_elements(open_elements_.size() - 1, offset);
+          break;
+        case GUMBO_TAG_OPTGROUP:
+          close_top(GUMBO_TAG_OPTION, offset);
+          close_top(GUMBO_TAG_OPTGROUP, offset);
+          break;
+        case GUMBO_TAG_OPTION:
+          close_top(GUMBO_TAG_OPTION, offset);
+          break;
+        case GUMBO_TAG_TBODY:
+        case GUMBO_TAG_THEAD:
+        case GUMBO_TAG_TFOOT:
+          close_until(tag_set_of({ GUMBO_TAG_TBODY, GUMBO_TAG_THEAD, GUMBO_TAG_TFOOT }),
+            table_boundaries, offset);
+          break;
+        case GUMBO_TAG_TR:
+          close_until(tag_set_of({ GUMBO_TAG_TR }), table_boundaries, offset);
+          break;
+        case GUMBO_TAG_TD:
+        case GUMBO_TAG_TH:
+          close_until(tag_set_of({ GUMBO_TAG_TD, GUMBO_TAG_TH }),
+            table_boundaries | tag_set_of({ GUMBO_TAG_TR }), offset);
+          break;
+        default:
+          break;
+        }
+      }
+
+      static AttributeEdit* find_edit(vector<AttributeEdit>& edits, const string& name) {
+        for (AttributeEdit& edit : edits) {
+          if (edit.name == name)
+            return &edit;
+        }
+        return nullptr;
+      }
+
+      static void apply_attribute_rule(const StreamRewriter::Rule& rule,
+        const GumboVector* attributes, vector<AttributeEdit>& edits) {
+        AttributeEdit* edit = find_edit(edits, rule.name);
+        if (!edit) {
+          edits.push_back(AttributeEdit{ rule.name, false, string(), false });
+          edit = &edits.back();
+          const GumboAttribute* attr = gumbo_get_attribute(attributes, rule.name.c_str());
+          if (attr)
+            edit->value = attr->value;
+          else
+            edit->is_removed = true;
+        }
+        switch (rule.action) {
+        case StreamRewriter::Action::SET_ATTRIBUTE:
+          edit->is_removed = false;
+          edit->value = rule.value;
+          break;
+        case StreamRewriter::Action::REMOVE_ATTRIBUTE:
+          edit->is_removed = true;
+          break;
+        default: {
+          if (edit->is_removed)
+            break;
+          string value;
+          if (rule.callback(edit->value, value))
+            edit->value = move(value);
+          else
+            edit->is_removed = true;
+          break;
+        }
+        }
+      }
+
+      /// Write a start tag with edited attributes, keeping the rest of its original text
+      void write_start_tag(const GumboToken& token, vector<AttributeEdit>& edits) {
+        const char* text = token.original_text.data;
+        const char* end = text + token.original_text.length;
+        const char* tail = end;
+        if (tail > text && tail[-1] == '>') {
+          --tail;
+          if (token.v.start_tag.is_self_closing && tail > text && tail[-1] == '/')
+            --tail;
+        }
+        const char* cursor = text;
+        // Duplicates of an edited attribute are dropped, or they would take its place once the
+        // first one is removed
+        for (const RawAttribute& attr : raw_attributes_of(token.original_text)) {
+          string name(attr.start, attr.name_end);
+          transform(name.begin(), name.end(), name.begin(), to_lower);
+          AttributeEdit* edit = find_edit(edits, name);
+          if (!edit)
+            continue;
+          bool is_dropped = edit->is_removed || edit->is_applied;
+          const char* keep_until = attr.start;
+          if (is_dropped) {
+            while (keep_until > cursor && is_space(keep_until[-1]))
+              --keep_until;
+          }
+          write(cursor, keep_until - cursor);
+          if (!is_dropped) {
+            string html;
+            append_attribute(html, attr.start, attr.name_end - attr.start, edit->value);
+            write(html);
+          }
+          cursor = attr.end;
+          edit->is_applied = true;
+        }
+        write(cursor, tail - cursor);
+        for (const AttributeEdit& edit : edits) {
+          if (edit.is_applied || edit.is_removed)
+            continue;
+          string html(" ");
+          append_attribute(html, edit.name.data(), edit.name.size(), edit.value);
+          write(html);
+        }
+        write(tail, end - tail);
+      }
+
+    public:
+      Rewrite(const vector<StreamRewriter::Rule>& rules, const char* source,
+        const StreamRewriter::Sink* sink, size_t chunk_size)
+        : rules_(rules), source_(source), sink_(sink), chunk_size_(chunk_size) {}
+
+      void start_tag(const GumboToken& token, bool is_foreign) {
+        size_t start = offset_of(token.original_text.data);
+        size_t end = start + token.original_text.length;
+        GumboTag tag = token.v.start_tag.tag;
+        string name;
+        if (tag == GUMBO_TAG_UNKNOWN)
+          name = tag_name_of(token.original_text);
+        if (!is_foreign)
+          close_implied(tag, start);
+        bool is_void = is_foreign ? token.v.start_tag.is_self_closing : is_void_tag(tag);
+        if (removed_depth_) {
+          if (!is_void)
+            open_elements_.push_back(OpenElement{ tag, move(name), {} });
+          return;
+        }
+
+        const GumboVector* attributes = &token.v.start_tag.attributes;
+        vector<const string*> before, after;
+        vector<AttributeEdit> edits;
+        bool is_removed = false;
+        for (const StreamRewriter::Rule& rule : rules_) {
+          if (!matches_any(rule.selectors, tag, name, attributes))
+            continue;
+          switch (rule.action) {
+          case StreamRewriter::Action::REMOVE:
+            is_removed = true;
+            break;
+          case StreamRewriter::Action::BEFORE:
+            before.push_back(&rule.name);
+            break;
+          case StreamRewriter::Action::AFTER:
+            after.push_back(&rule.name);
+            break;
+          default:
+            apply_attribute_rule(rule, attributes, edits);
+            break;
+          }
+        }
+
+        if (!before.empty() || is_removed || !edits.empty())
+          copy_source(start);
+        for (const string* html : before)
+          write(*html);
+        if (is_removed) {
+          if (is_void) {
+            copied_ = end;
+            for (const string* html : after)
+              write(*html);
+          } else {
+            open_elements_.push_back(OpenElement{ tag, move(name), move(after) });
+            removed_depth_ = open_elements_.size();
+          }
+          return;
+        }
+        if (!edits.empty()) {
+          write_start_tag(token, edits);
+          copied_ = end;
+        }
+        if (!is_void) {
+          open_elements_.push_back(OpenElement{ tag, move(name), move(after) });
+        } else if (!after.empty()) {
+          copy_source(end);
+          for (const string* html : after)
+            write(*html);
+        }
+      }
+
+      void end_tag(const GumboToken& token) {
+        size_t start = offset_of(token.original_text.data);
+        size_t end = start + token.original_text.length;
+        GumboTag tag = token.v.end_tag;
+        string name;
+        if (tag == GUMBO_TAG_UNKNOWN)
+          name = tag_name_of(token.original_text);
+        for (size_t i = open_elements_.size(); i > 0; --i) {
+          const OpenElement& element = open_elements_[i - 1];
+          if (element.tag == tag && (tag != GUMBO_TAG_UNKNOWN || element.name == name)) {
+            // Elements left open within this one end before its end tag
+            close_elements(i, start);
+            close_elements(i - 1, end);
+            return;
+          }
+        }
+      }
+
+      void finish(size_t length) {
+        close_elements(0, length);
+        copy_source(length);
+        if (sink_ && !html_.empty())
+          (*sink_)(html_.data(), html_.size());
+      }
+
+      void reserve(size_t size) { html_.reserve(size); }
+
+      string release() { return move(html_); }
+    };
+
+    void run(const char* html, size_t length, Rewrite& rewrite) {
+      // Parse errors are of no use here, so none are recorded
+      GumboOptions options = kGumboDefaultOptions;
+      options.max_errors = 0;
+      LexerHandle lexer(&options, html, length);
+      GumboToken token;
+      while (true) {
+        bool was_foreign = gumbo_lexer_in_foreign_content(lexer.get());
+        if (!gumbo_lexer_next(lexer.get(), &token))
+          break;
+        TokenHandle token_handle(&token);
+        if (token.type == GUMBO_TOKEN_START_TAG) {
+          // A start tag that breaks out of foreign content is an HTML element
+          rewrite.start_tag(token, was_foreign && gumbo_lexer_in_foreign_content(lexer.get()));
+        } else if (token.type == GUMBO_TOKEN_END_TAG) {
+          rewrite.end_tag(token);
+        }
+      }
+      rewrite.finish(length);
+    }
+  }
+
+  vector<Selector> parse_selectors(const string& selector) {
+    return SelectorParser(selector).parse();
+  }
+
+  void StreamRewriter::add_rule(const string& selector, Action action, string name, string value,
+    AttributeCallback callback) {
+    if (action != Action::BEFORE && action != Action::AFTER)
+      transform(name.begin(), name.end(), name.begin(), to_lower);
+    rules_.push_back(Rule{ parse_selectors(selector), action, move(name), move(value), move(callback) });
+  }
+
+  void StreamRewriter::rewrite(const char* html, size_t length, const Sink& sink, size_t chunk_size) const {
+    Rewrite rewrite(rules_, html, &sink, chunk_size);
+    rewrite.reserve(chunk_size);
+    run(html, length, rewrite);
+  }
+
+  string StreamRewriter::rewrite(const char* html, size_t length) const {
+    Rewrite rewrite(rules_, html, nullptr, 0);
+    rewrite.reserve(length);
+    run(html, length, rewrite);
+    return rewrite.release();
+  }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <gumbo/gumbo.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gumbo_python {
+
+  /**
+   * A compound selector: an optional tag name followed by any number of #id,
+   * .class, [attr] and [attr=value] conditions.
+   */
+  struct Selector {
+    struct AttributeCondition {
+      std::string name;
+      bool has_value;
+      std::string value;
+    };
+
+    /// GUMBO_TAG_LAST matches any tag
+    GumboTag tag = GUMBO_TAG_LAST;
+    /// Lowercase tag name for tags unknown to Gumbo
+    std::string tag_name;
+    std::vector<std::string> classes;
+    std::vector<AttributeCondition> attributes;
+  };
+
+  /**
+   * Parse a comma-separated list of compound selectors.
+   * Throws std::invalid_argument if the selector is empty or malformed.
+   */
+  std::vector<Selector> parse_selectors(const std::string& selector);
+
+  /**
+   * Rewrites HTML token by token without building a tree.
+   *
+   * Only the tokenizer runs over the input. The end of each element is tracked
+   * with a stack of open tags that handles the common implied end tags
+   * (<p>, <li>, <td> etc.), but not the full tree construction rules. Everything
+   * that no rule applies to is copied from the source as is.
+   */
+  class StreamRewriter {
+  public:
+    /**
+     * Compute a new value for an attribute from its current value.
+     * Return false to remove the attribute.
+     */
+    using AttributeCallback = std::function<bool(const std::string& value, std::string& result)>;
+
+    /// Receives the rewritten HTML in chunks
+    using Sink = std::function<void(const char* data, size_t length)>;
+
+    enum class Action {
+      SET_ATTRIBUTE,
+      REMOVE_ATTRIBUTE,
+      REWRITE_ATTRIBUTE,
+      REMOVE,
+      BEFORE,
+      AFTER
+    };
+
+    struct Rule {
+      std::vector<Selector> selectors;
+      Action action;
+      /// Attribute name, or the HTML to insert for BEFORE and AFTER
+      std::string name;
+      std::string value;
+      AttributeCallback callback;
+    };
+
+  private:
+    std::vector<Rule> rules_;
+
+    void add_rule(const std::string& selector, Action action, std::string name,
+      std::string value = std::string(), AttributeCallback callback = nullptr);
+
+  public:
+    /// Set an attribute of matching elements, adding it if needed
+    void set_attribute(const std::string& selector, std::string name, std::string value) {
+      add_rule(selector, Action::SET_ATTRIBUTE, std::move(name), std::move(value));
+    }
+
+    void remove_attribute(const std::string& selector, std::string name) {
+      add_rule(selector, Action::REMOVE_ATTRIBUTE, std::move(name));
+    }
+
+    /// Rewrite an attribute of matching elements that have it
+    void rewrite_attribute(const std::string& selector, std::string name, AttributeCallback callback) {
+      add_rule(selector, Action::REWRITE_ATTRIBUTE, std::move(name), std::string(), std::move(callback));
+    }
+
+    /// Remove matching elements with all their content
+    void remove(const std::string& selector) { add_rule(selector, Action::REMOVE, std::string()); }
+
+    /// Insert raw HTML before the start tag of matching elements
+    void before(const std::string& selector, std::string html) {
+      add_rule(selector, Action::BEFORE, std::move(html));
+    }
+
+    /// Insert raw HTML after the end of matching elements
+    void after(const std::string& selector, std::string html) {
+      add_rule(selector, Action::AFTER, std::move(html));
+    }
+
+    const std::vector<Rule>& rules() const { return rules_; }
+
+    /**
+     * Rewrite HTML, passing the output to sink in chunks of about chunk_size bytes.
+     * Unchanged source larger than a chunk is passed to sink directly without copying.
+     */
+    void rewrite(const char* html, size_t length, const Sink& sink, size_t chunk_size) const;
+
+    /// Rewrite HTML into a string
+    std::string rewrite(const char* html, size_t length) const;
+  };
+}
@@ -0,0 +1,594 @@
+#include "serializer.h"
+
+#include "text.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    TagSet tag_set_of(initializer_list<GumboTag> tags) {
+      TagSet tag_set;
+      for (GumboTag tag : tags)
+        tag_set.set(tag);
+      return tag_set;
+    }
+
+    const TagSet void_elements = tag_set_of({
+      GUMBO_TAG_AREA, GUMBO_TAG_BASE, GUMBO_TAG_BASEFONT, GUMBO_TAG_BGSOUND, GUMBO_TAG_BR,
+      GUMBO_TAG_COL, GUMBO_TAG_EMBED, GUMBO_TAG_FRAME, GUMBO_TAG_HR, GUMBO_TAG_IMG,
+      GUMBO_TAG_INPUT, GUMBO_TAG_KEYGEN, GUMBO_TAG_LINK, GUMBO_TAG_META, GUMBO_TAG_PARAM,
+      GUMBO_TAG_SOURCE, GUMBO_TAG_TRACK, GUMBO_TAG_WBR });
+
+    /// Elements whose text content is serialized without escaping
+    const TagSet raw_text_elements = tag_set_of({
+      GUMBO_TAG_STYLE, GUMBO_TAG_SCRIPT, GUMBO_TAG_XMP, GUMBO_TAG_IFRAME, GUMBO_TAG_NOEMBED,
+      GUMBO_TAG_NOFRAMES, GUMBO_TAG_PLAINTEXT });
+
+    /// Elements where the parser drops a newline right after the start tag
+    const TagSet newline_elements = tag_set_of({
+      GUMBO_TAG_PRE, GUMBO_TAG_TEXTAREA, GUMBO_TAG_LISTING });
+
+    /// Elements within a table that content can be foster-parented out of
+    const TagSet table_sections = tag_set_of({
+      GUMBO_TAG_TBODY, GUMBO_TAG_THEAD, GUMBO_TAG_TFOOT, GUMBO_TAG_TR });
+
+    /// Elements that get the content of the whole document
+    const TagSet document_elements = tag_set_of({ GUMBO_TAG_HTML, GUMBO_TAG_HEAD, GUMBO_TAG_BODY });
+
+    /// Elements whose content is left as is when pretty-printing
+    const TagSet preformatted_elements = raw_text_elements | newline_elements;
+
+    inline bool is_space(char c) {
+      return c == ' ' || c == '\n' || c == '\t' || c == '\f' || c == '\r';
+    }
+
+    inline bool is_element(const GumboNode* node) {
+      return node && (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE);
+    }
+
+    inline bool html_tag_in(const GumboNode* node, const TagSet& tags) {
+      return is_element(node) && node->v.element.tag_namespace == GUMBO_NAMESPACE_HTML &&
+        node->v.element.tag < GUMBO_TAG_LAST && tags.test(node->v.element.tag);
+    }
+
+    /// Characters that need escaping: 1 - in text, 2 - in attribute values, 3 - in both
+    struct EscapeTable {
+      unsigned char flags[256] = {};
+
+      EscapeTable() {
+        flags[static_cast<unsigned char>('&')] = 3;
+        flags[0xC2] = 3;  // Lead byte of U+00A0
+        flags[static_cast<unsigned char>('<')] = 1;
+        flags[static_cast<unsigned char>('>')] = 1;
+        flags[static_cast<unsigned char>('"')] = 2;
+      }
+    };
+
+    const EscapeTable escape_table;
+
+    inline const GumboVector* children_of(const GumboNode* node) {
+      if (node->type == GUMBO_NODE_DOCUMENT)
+        return &node->v.document.children;
+      return &node->v.element.children;
+    }
+
+    bool has_visible_children(const GumboNode* node) {
+      const GumboVector* children = children_of(node);
+      for (size_t i = 0; i < children->length; ++i) {
+        if (static_cast<const GumboNode*>(children->data[i])->type != GUMBO_NODE_WHITESPACE)
+          return true;
+      }
+      return false;
+    }
+
+    const int edited_flags = GUMBO_INSERTION_ATTRIBUTES_EDITED | GUMBO_INSERTION_CHILDREN_EDITED |
+      GUMBO_INSERTION_DESCENDANT_EDITED;
+
+    /// Nodes with these flags are not where their source text is, or have no source text at all
+    const int unsafe_flags = GUMBO_INSERTION_BY_PARSER | GUMBO_INSERTION_IMPLIED |
+      GUMBO_INSERTION_CONVERTED_FROM_END_TAG | GUMBO_INSERTION_FROM_ISINDEX |
+      GUMBO_INSERTION_RECONSTRUCTED_FORMATTING_ELEMENT | GUMBO_INSERTION_ADOPTION_AGENCY_CLONED |
+      GUMBO_INSERTION_ADOPTION_AGENCY_MOVED | GUMBO_INSERTION_FOSTER_PARENTED;
+
+    inline bool has_source_start_tag(const GumboNode* node) {
+      return !(node->parse_flags & unsafe_flags) && node->v.element.original_tag.length;
+    }
+
+    inline bool has_source_end_tag(const GumboNode* node) {
+      return has_source_start_tag(node) &&
+        !(node->parse_flags & GUMBO_INSERTION_IMPLICIT_END_TAG) &&
+        node->v.element.original_end_tag.length;
+    }
+
+    /// Get the range of source text a node was parsed from
+    bool source_span(const GumboNode* node, size_t& start, size_t& end) {
+      if (node->parse_flags & unsafe_flags)
+        return false;
+      if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) {
+        const GumboElement& element = node->v.element;
+        // Content after the end tags of these elements is still added to them
+        if (!element.original_tag.length || html_tag_in(node, document_elements))
+          return false;
+        // Content foster-parented out of a table precedes it in the tree but is in its source
+        for (const GumboNode* current = node; current->parent; current = current->parent) {
+          const GumboVector* siblings = children_of(current->parent);
+          size_t index = current->index_within_parent;
+          if (index > 0 && index < siblings->length) {
+            const GumboNode* previous = static_cast<GumboNode*>(siblings->data[index - 1]);
+            const GumboSourcePosition& position = is_element(previous) ?
+              previous->v.element.start_pos : previous->v.text.start_pos;
+            if (position.offset > current->v.element.start_pos.offset)
+              return false;
+          }
+          if (!html_tag_in(current, table_sections))
+            break;
+        }
+        start = element.start_pos.offset;
+        if (has_source_end_tag(node))
+          end = element.end_pos.offset + element.original_end_tag.length;
+        else if (element.end_pos.offset == start && !element.children.length)
+          // Void and self-closing elements are closed by their own start tag
+          end = start + element.original_tag.length;
+        else
+          end = element.end_pos.offset;
+        return end >= start + element.original_tag.length;
+      }
+      if (node->type == GUMBO_NODE_DOCUMENT || !node->v.text.original_text.length)
+        return false;
+      start = node->v.text.start_pos.offset;
+      end = start + node->v.text.original_text.length;
+      // Whitespace after an ignored end tag such as </body> runs over the end tag of its parent
+      const GumboNode* parent = node->parent;
+      return !parent || !is_element(parent) || !has_source_end_tag(parent) ||
+        end <= parent->v.element.end_pos.offset;
+    }
+
+    /// Get the range of source text between the start and end tags of an element
+    bool inner_span(const GumboNode* node, size_t& start, size_t& end) {
+      if ((node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) ||
+          !has_source_end_tag(node))
+        return false;
+      const GumboElement& element = node->v.element;
+      start = element.start_pos.offset + element.original_tag.length;
+      end = element.end_pos.offset;
+      return start <= end;
+    }
+
+    /// True for nodes inserted through the gumbo_edit.h API, which have no source text
+    inline bool is_inserted(const GumboNode* node) {
+      if (node->type == GUMBO_NODE_DOCUMENT || (node->parse_flags & unsafe_flags))
+        return false;
+      if (is_element(node))
+        return !node->v.element.original_tag.length;
+      return !node->v.text.original_text.length;
+    }
+
+    /// A range of the source replaced with new HTML
+    struct Replacement {
+      size_t start;
+      size_t end;
+      string html;
+    };
+
+    /// Collects the regions of the source that have to be re-serialized because of edits
+    class ReplacementCollector {
+    private:
+      const char* source_;
+      size_t length_;
+      const vector<RemovedNode>& removed_;
+
+      string serialize_node(const GumboNode* node) {
+        Serializer serializer;
+        serializer.set_source(source_, length_);
+        serializer.append_node(node);
+        return serializer.release();
+      }
+
+      /**
+       * Splice the inserted children of a node into the source between its other children
+       * and cut out the source of the removed ones. The children that are left have to be
+       * in source order, and together with the removed children they have to cover the
+       * content of the element if it has an end tag.
+       */
+      bool splice_children(const GumboNode* node) {
+        // Children of void elements are not serialized
+        if (is_void_element(node))
+          return false;
+        vector<pair<size_t, size_t>> removed_spans;
+        for (const RemovedNode& removed : removed_) {
+          if (removed.parent != node || is_inserted(removed.node))
+            continue;
+          size_t start, end;
+          if (!source_span(removed.node, start, end) || end > length_)
+            return false;
+          removed_spans.emplace_back(start, end);
+        }
+        sort(removed_spans.begin(), removed_spans.end());
+        size_t inner_start = 0, inner_end = 0;
+        bool has_inner_span = inner_span(node, inner_start, inner_end) && inner_end <= length_;
+        bool has_cursor = has_inner_span;
+        size_t cursor = inner_start;
+        if (!has_inner_span && is_element(node) && has_source_start_tag(node)) {
+          cursor = node->v.element.start_pos.offset + node->v.element.original_tag.length;
+          has_cursor = true;
+        }
+        size_t removed_index = 0;
+        // Cut out the removed children before a source offset
+        auto cut_removed = [&](size_t offset) {
+          for (; removed_index < removed_spans.size() &&
+              removed_spans[removed_index].first < offset; ++removed_index) {
+            const pair<size_t, size_t>& span = removed_spans[removed_index];
+            if (has_inner_span && span.first != cursor)
+              return false;
+            if ((has_cursor && span.first < cursor) || span.second > offset)
+              return false;
+            replacements.push_back(Replacement{ span.first, span.second, string() });
+            cursor = span.second;
+            has_cursor = true;
+          }
+          return true;
+        };
+        size_t mark = replacements.size();
+        string inserted;
+        const GumboVector* children = children_of(node);
+        for (size_t i = 0; i < children->length; ++i) {
+          const GumboNode* child = static_cast<GumboNode*>(children->data[i]);
+          if (is_inserted(child)) {
+            inserted += serialize_node(child);
+            continue;
+          }
+          size_t start, end;
+          bool is_valid = source_span(child, start, end) && end <= length_ &&
+            (!has_cursor || start >= cursor);
+          if (is_valid && !inserted.empty()) {
+            // New content goes right after the preceding child
+            replacements.push_back(Replacement{ has_cursor ? cursor : start,
+              has_cursor ? cursor : start, move(inserted) });
+            inserted.clear();
+          }
+          if (!is_valid || !cut_removed(start) || (has_inner_span && start != cursor)) {
+            replacements.resize(mark);
+            return false;
+          }
+          if ((child->parse_flags & edited_flags) && !collect(child))
+            replacements.push_back(Replacement{ start, end, serialize_node(child) });
+          cursor = end;
+          has_cursor = true;
+        }
+        if (!cut_removed(has_inner_span ? inner_end : length_ + 1) || !has_cursor ||
+            removed_index != removed_spans.size() || (has_inner_span && cursor != inner_end)) {
+          replacements.resize(mark);
+          return false;
+        }
+        if (!inserted.empty())
+          replacements.push_back(Replacement{ cursor, cursor, move(inserted) });
+        return true;
+      }
+
+    public:
+      vector<Replacement> replacements;
+
+      ReplacementCollector(const char* source, size_t length, const vector<RemovedNode>& removed)
+        : source_(source), length_(length), removed_(removed) {}
+
+      /**
+       * Add replacements for the edits within a node.
+       * Returns false if the edits can only be handled by re-serializing a larger
+       * part of the document, in which case no replacements are added.
+       */
+      bool collect(const GumboNode* node) {
+        if (node->type != GUMBO_NODE_DOCUMENT && node->type != GUMBO_NODE_ELEMENT &&
+            node->type != GUMBO_NODE_TEMPLATE)
+          return false;
+        size_t mark = replacements.size();
+        if (node->type != GUMBO_NODE_DOCUMENT && (node->parse_flags & GUMBO_INSERTION_ATTRIBUTES_EDITED)) {
+          if (!has_source_start_tag(node))
+            return false;
+          Serializer serializer;
+          serializer.append_start_tag(node);
+          size_t start = node->v.element.start_pos.offset;
+          replacements.push_back(Replacement{ start, start + node->v.element.original_tag.length,
+            serializer.release() });
+        }
+        if (node->parse_flags & GUMBO_INSERTION_CHILDREN_EDITED) {
+          if (splice_children(node))
+            return true;
+          replacements.resize(mark);
+          return false;
+        }
+        if (!(node->parse_flags & GUMBO_INSERTION_DESCENDANT_EDITED))
+          return true;
+        const GumboVector* children = children_of(node);
+        for (size_t i = 0; i < children->length; ++i) {
+          const GumboNode* child = static_cast<GumboNode*>(children->data[i]);
+          if (!(child->parse_flags & edited_flags) || collect(child))
+            continue;
+          size_t start, end;
+          if (source_span(child, start, end) && end <= length_) {
+            replacements.push_back(Replacement{ start, end, serialize_node(child) });
+            continue;
+          }
+          // Fall back to re-serializing this node in its parent
+          replacements.resize(mark);
+          return false;
+        }
+        return true;
+      }
+    };
+  }
+
+  bool is_void_element(const GumboNode* node) {
+    return html_tag_in(node, void_elements);
+  }
+
+  bool is_void_tag(GumboTag tag) {
+    return tag < GUMBO_TAG_LAST && void_elements.test(tag);
+  }
+
+  string element_name(const GumboNode* node) {
+    const GumboElement& element = node->v.element;
+    if (element.tag != GUMBO_TAG_UNKNOWN && element.tag_namespace != GUMBO_NAMESPACE_SVG)
+      return gumbo_normalized_tagname(element.tag);
+    GumboStringPiece original_tag = element.original_tag;
+    if (!original_tag.data || !original_tag.length)
+      return gumbo_normalized_tagname(element.tag);
+    gumbo_tag_from_original_text(&original_tag);
+    if (element.tag_namespace == GUMBO_NAMESPACE_SVG) {
+      const char* svg_name = gumbo_normalize_svg_tagname(&original_tag);
+      if (svg_name)
+        return svg_name;
+    }
+    string name(original_tag.data, original_tag.length);
+    for (char& c : name) {
+      if (c >= 'A' && c <= 'Z')
+        c |= 0x20;
+    }
+    return name;
+  }
+
+  void Serializer::append_escaped(const char* text, size_t length, bool in_attribute) {
+    const unsigned char mask = in_attribute ? 2 : 1;
+    const char* end = text + length;
+    const char* run = text;
+    for (const char* p = text; p < end; ++p) {
+      unsigned char flags = escape_table.flags[static_cast<unsigned char>(*p)];
+      if (!(flags & mask))
+        continue;
+      const char* entity;
+      size_t skip = 1;
+      switch (*p) {
+      case '&':
+        entity = "&amp;";
+        break;
+      case '<':
+        entity = "&lt;";
+        break;
+      case '>':
+        entity = "&gt;";
+        break;
+      case '"':
+        entity = "&quot;";
+        break;
+      default:
+        if (p + 1 >= end || static_cast<unsigned char>(p[1]) != 0xA0)
+          continue;
+        entity = "&nbsp;";
+        skip = 2;
+        break;
+      }
+      html_.append(run, p - run);
+      html_ += entity;
+      p += skip - 1;
+      run = p + 1;
+    }
+    html_.append(run, end - run);
+  }
+
+  void Serializer::append_text(const GumboNode* node) {
+    const char* text = node->v.text.text;
+    size_t length = strlen(text);
+    switch (node->type) {
+    case GUMBO_NODE_COMMENT:
+      html_ += "<!--";
+      html_.append(text, length);
+      html_ += "-->";
+      return;
+    case GUMBO_NODE_CDATA:
+      html_ += "<![CDATA[";
+      html_.append(text, length);
+      html_ += "]]>";
+      return;
+    default:
+      break;
+    }
+    if (pretty_ && !preformatted_) {
+      // Text goes on its own line with the surrounding whitespace trimmed
+      while (length && is_space(*text)) {
+        ++text;
+        --length;
+      }
+      while (length && is_space(text[length - 1]))
+        --length;
+    }
+    if (html_tag_in(node->parent, raw_text_elements))
+      html_.append(text, length);
+    else
+      append_escaped(text, length, false);
+  }
+
+  void Serializer::append_indent() {
+    if (!html_.empty())
+      html_ += '\n';
+    html_.append(2 * depth_, ' ');
+  }
+
+  void Serializer::append_start_tag(const GumboNode* node) {
+    const GumboElement& element = node->v.element;
+    html_ += '<';
+    html_ += element_name(node);
+    for (size_t i = 0; i < element.attributes.length; ++i) {
+      const GumboAttribute* attr = static_cast<const GumboAttribute*>(element.attributes.data[i]);
+      html_ += ' ';
+      switch (attr->attr_namespace) {
+      case GUMBO_ATTR_NAMESPACE_XLINK:
+        html_ += "xlink:";
+        break;
+      case GUMBO_ATTR_NAMESPACE_XML:
+        html_ += "xml:";
+        break;
+      case GUMBO_ATTR_NAMESPACE_XMLNS:
+        if (strcmp(attr->name, "xmlns") != 0)
+          html_ += "xmlns:";
+        break;
+      default:
+        break;
+      }
+      html_ += attr->name;
+      html_ += "=\"";
+      append_escaped(attr->value, strlen(attr->value), true);
+      html_ += '"';
+    }
+    html_ += '>';
+  }
+
+  void Serializer::append_end_tag(const GumboNode* node) {
+    html_ += "</";
+    html_ += element_name(node);
+    html_ += '>';
+  }
+
+  void Serializer::append_node(const GumboNode* node) {
+    // The second member is true when the element is being left
+    vector<pair<const GumboNode*, bool>> stack;
+    stack.emplace_back(node, false);
+    while (!stack.empty()) {
+      const GumboNode* current = stack.back().first;
+      bool leaving = stack.back().second;
+      stack.pop_back();
+      if (leaving) {
+        --depth_;
+        bool preformatted = html_tag_in(current, preformatted_elements);
+        if (pretty_ && preformatted)
+          --preformatted_;
+        else if (pretty_ && !preformatted_ && has_visible_children(current))
+          append_indent();
+        if (source_ && has_source_end_tag(current))
+          append_raw(current->v.element.original_end_tag.data,
+            current->v.element.original_end_tag.length);
+        else
+          append_end_tag(current);
+        continue;
+      }
+      if (source_ && current != node && !(current->parse_flags & edited_flags)) {
+        size_t start, end;
+        if (source_span(current, start, end) && end <= source_length_) {
+          append_raw(source_ + start, end - start);
+          continue;
+        }
+      }
+      switch (current->type) {
+      case GUMBO_NODE_DOCUMENT: {
+        const GumboDocument& document = current->v.document;
+        if (document.has_doctype) {
+          html_ += "<!DOCTYPE ";
+          html_ += document.name;
+          html_ += '>';
+        }
+        for (size_t i = document.children.length; i > 0; --i)
+          stack.emplace_back(static_cast<GumboNode*>(document.children.data[i - 1]), false);
+        break;
+      }
+      case GUMBO_NODE_ELEMENT:
+      case GUMBO_NODE_TEMPLATE: {
+        if (pretty_ && !preformatted_)
+          append_indent();
+        if (source_ && !(current->parse_flags & GUMBO_INSERTION_ATTRIBUTES_EDITED) &&
+            has_source_start_tag(current))
+          append_raw(current->v.element.original_tag.data, current->v.element.original_tag.length);
+        else
+          append_start_tag(current);
+        if (is_void_element(current))
+          break;
+        const GumboVector& children = current->v.element.children;
+        if (html_tag_in(current, newline_elements) && children.length) {
+          const GumboNode* first = static_cast<GumboNode*>(children.data[0]);
+          if ((first->type == GUMBO_NODE_TEXT || first->type == GUMBO_NODE_WHITESPACE) &&
+              first->v.text.text[0] == '\n')
+            html_ += '\n';
+        }
+        if (pretty_ && html_tag_in(current, preformatted_elements))
+          ++preformatted_;
+        ++depth_;
+        stack.emplace_back(current, true);
+        for (size_t i = children.length; i > 0; --i)
+          stack.emplace_back(static_cast<GumboNode*>(children.data[i - 1]), false);
+        break;
+      }
+      case GUMBO_NODE_WHITESPACE:
+        if (pretty_ && !preformatted_)
+          break;
+        append_text(current);
+        break;
+      default:
+        if (pretty_ && !preformatted_)
+          append_indent();
+        append_text(current);
+        break;
+      }
+    }
+  }
+
+  string serialize(const GumboNode* node, bool pretty) {
+    Serializer serializer(pretty);
+    if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) {
+      const GumboElement& element = node->v.element;
+      if (element.end_pos.offset > element.start_pos.offset)
+        serializer.reserve(element.end_pos.offset - element.start_pos.offset);
+    }
+    serializer.append_node(node);
+    return serializer.release();
+  }
+
+  string serialize_preserving(const GumboNode* document, const char* source, size_t length,
+      const vector<RemovedNode>& removed) {
+    if (!(document->parse_flags & edited_flags))
+      return string(source, length);
+    ReplacementCollector collector(source, length, removed);
+    if (collector.collect(document)) {
+      vector<Replacement>& replacements = collector.replacements;
+      // Insertions are empty ranges that have to stay ahead of the edits starting at the same offset
+      stable_sort(replacements.begin(), replacements.end(),
+        [](const Replacement& a, const Replacement& b) { return a.start < b.start; });
+      bool disjoint = true;
+      size_t size = length;
+      for (size_t i = 0; i < replacements.size(); ++i) {
+        if (i && replacements[i].start < replacements[i - 1].end)
+          disjoint = false;
+        size += replacements[i].html.size();
+      }
+      if (disjoint) {
+        string html;
+        html.reserve(size);
+        size_t cursor = 0;
+        for (const Replacement& replacement : replacements) {
+          html.append(source + cursor, replacement.start - cursor);
+          html += replacement.html;
+          cursor = replacement.end;
+        }
+        html.append(source + cursor, length - cursor);
+        return html;
+      }
+    }
+    Serializer serializer;
+    serializer.set_source(source, length);
+    serializer.reserve(length);
+    serializer.append_node(document);
+    return serializer.release();
+  }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <gumbo/gumbo.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gumbo_python {
+
+  /**
+   * Serializes nodes to HTML following the WHATWG HTML fragment serialization
+   * algorithm. Output is appended to an internal buffer that grows as needed.
+   */
+  class Serializer {
+  private:
+    std::string html_;
+    bool pretty_;
+    /// Source the tree was parsed from. Unedited nodes are copied from it if set.
+    const char* source_ = nullptr;
+    size_t source_length_ = 0;
+    unsigned int depth_ = 0;
+    /// Nesting level of elements whose content is written verbatim when pretty-printing
+    unsigned int preformatted_ = 0;
+
+    void append_escaped(const char* text, size_t length, bool in_attribute);
+
+    void append_text(const GumboNode* node);
+
+    void append_indent();
+
+  public:
+    explicit Serializer(bool pretty = false) : pretty_(pretty) {}
+
+    /**
+     * Set the source text the tree was parsed from. Nodes that were not edited
+     * through the gumbo_edit.h API are then copied verbatim from the source,
+     * as are the original tags of edited elements where possible.
+     */
+    void set_source(const char* source, size_t length) {
+      source_ = source;
+      source_length_ = length;
+    }
+
+    /// Serialize a node, its descendants and, for elements, its start and end tags
+    void append_node(const GumboNode* node);
+
+    /// Serialize the start tag of an element with all its attributes
+    void append_start_tag(const GumboNode* node);
+
+    /// Serialize the end tag of an element
+    void append_end_tag(const GumboNode* node);
+
+    /// Append raw HTML without escaping
+    void append_raw(const char* html, size_t length) { html_.append(html, length); }
+
+    void reserve(size_t size) { html_.reserve(size); }
+
+    const std::string& str() const { return html_; }
+
+    /// Move the serialized HTML out of the serializer
+    std::string release() { return std::move(html_); }
+  };
+
+  /// True for HTML elements that have no end tag or content
+  bool is_void_element(const GumboNode* node);
+
+  /// True for the tags of HTML void elements
+  bool is_void_tag(GumboTag tag);
+
+  /// Get the serialized tag name of an element
+  std::string element_name(const GumboNode* node);
+
+  /// A node removed from the tree after parsing and the parent it was removed from
+  struct RemovedNode {
+    const GumboNode* node;
+    const GumboNode* parent;
+  };
+
+  /// Serialize a node to HTML
+  std::string serialize(const GumboNode* node, bool pretty = false);
+
+  /**
+   * Serialize a document so that the output is identical to the source it was
+   * parsed from except for the parts edited through the gumbo_edit.h API.
+   * Only the start tags of elements with edited attributes and inserted children
+   * are serialized, and the source of removed nodes is cut out. The removed
+   * nodes have to be kept until then. Where the tree does not map cleanly to
+   * the source (e.g. misnested tags), a larger enclosing part of the document
+   * is re-serialized instead.
+   */
+  std::string serialize_preserving(const GumboNode* document, const char* source, size_t length,
+    const std::vector<RemovedNode>& removed);
+}
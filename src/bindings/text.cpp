@@ -0,0 +1,180 @@
+#include "text.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    TagSet make_block_elements() {
+      TagSet tags;
+      for (GumboTag tag : {
+          GUMBO_TAG_ADDRESS, GUMBO_TAG_ARTICLE, GUMBO_TAG_ASIDE, GUMBO_TAG_BLOCKQUOTE,
+          GUMBO_TAG_BODY, GUMBO_TAG_BR, GUMBO_TAG_CAPTION, GUMBO_TAG_CENTER, GUMBO_TAG_DD,
+          GUMBO_TAG_DETAILS, GUMBO_TAG_DIR, GUMBO_TAG_DIV, GUMBO_TAG_DL, GUMBO_TAG_DT,
+          GUMBO_TAG_FIELDSET, GUMBO_TAG_FIGCAPTION, GUMBO_TAG_FIGURE, GUMBO_TAG_FOOTER,
+          GUMBO_TAG_FORM, GUMBO_TAG_FRAMESET, GUMBO_TAG_H1, GUMBO_TAG_H2, GUMBO_TAG_H3,
+          GUMBO_TAG_H4, GUMBO_TAG_H5, GUMBO_TAG_H6, GUMBO_TAG_HEAD, GUMBO_TAG_HEADER,
+          GUMBO_TAG_HGROUP, GUMBO_TAG_HR, GUMBO_TAG_HTML, GUMBO_TAG_LEGEND, GUMBO_TAG_LI,
+          GUMBO_TAG_LISTING, GUMBO_TAG_MAIN, GUMBO_TAG_MENU, GUMBO_TAG_NAV, GUMBO_TAG_OL,
+          GUMBO_TAG_OPTGROUP, GUMBO_TAG_OPTION, GUMBO_TAG_P, GUMBO_TAG_PLAINTEXT,
+          GUMBO_TAG_PRE, GUMBO_TAG_SECTION, GUMBO_TAG_SELECT, GUMBO_TAG_SUMMARY,
+          GUMBO_TAG_TABLE, GUMBO_TAG_TBODY, GUMBO_TAG_TD, GUMBO_TAG_TEXTAREA,
+          GUMBO_TAG_TFOOT, GUMBO_TAG_TH, GUMBO_TAG_THEAD, GUMBO_TAG_TITLE, GUMBO_TAG_TR,
+          GUMBO_TAG_UL, GUMBO_TAG_XMP })
+        tags.set(tag);
+      return tags;
+    }
+
+    const TagSet block_elements = make_block_elements();
+
+    inline bool is_space(char c) {
+      return c == ' ' || c == '\n' || c == '\t' || c == '\f' || c == '\r';
+    }
+
+    inline const GumboVector* children_of(const GumboNode* node) {
+      if (node->type == GUMBO_NODE_DOCUMENT)
+        return &node->v.document.children;
+      else if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE)
+        return &node->v.element.children;
+      return nullptr;
+    }
+
+    /// Upper bound guess for the text size: the span of source text the node was parsed from
+    size_t estimate_text_size(const GumboNode* node) {
+      if (node->type == GUMBO_NODE_DOCUMENT) {
+        size_t size = 0;
+        for (size_t i = 0; i < node->v.document.children.length; ++i)
+          size += estimate_text_size(static_cast<GumboNode*>(node->v.document.children.data[i]));
+        return size;
+      }
+      if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) {
+        const GumboElement& element = node->v.element;
+        if (element.end_pos.offset > element.start_pos.offset)
+          return element.end_pos.offset - element.start_pos.offset;
+        return 0;
+      }
+      return node->v.text.original_text.length;
+    }
+
+    /// Accumulates text chunks into a single buffer, inserting separators at block boundaries
+    class TextBuilder {
+    private:
+      string& out_;
+      const string& separator_;
+      bool strip_;
+      bool pending_break_ = false;
+      bool pending_space_ = false;
+      bool block_has_text_ = false;
+
+    public:
+      TextBuilder(string& out, const string& separator, bool strip) :
+        out_(out), separator_(separator), strip_(strip) {}
+
+      void block_boundary() {
+        pending_break_ = true;
+        pending_space_ = false;
+        block_has_text_ = false;
+      }
+
+      void append(const char* text, size_t length) {
+        if (!length)
+          return;
+        if (!strip_) {
+          if (pending_break_ && !out_.empty())
+            out_ += separator_;
+          pending_break_ = false;
+          out_.append(text, length);
+          return;
+        }
+        const char* end = text + length;
+        while (text < end) {
+          if (is_space(*text)) {
+            pending_space_ = block_has_text_;
+            ++text;
+            continue;
+          }
+          if (pending_break_) {
+            if (!out_.empty())
+              out_ += separator_;
+            pending_break_ = false;
+          } else if (pending_space_) {
+            out_ += ' ';
+          }
+          pending_space_ = false;
+          block_has_text_ = true;
+          const char* run = text;
+          while (text < end && !is_space(*text))
+            ++text;
+          out_.append(run, text - run);
+        }
+      }
+    };
+  }
+
+  TagSet make_tag_set(const vector<string>& tag_names) {
+    TagSet tags;
+    for (const string& name : tag_names) {
+      GumboTag tag = gumbo_tagn_enum(name.data(), static_cast<int>(name.size()));
+      if (tag == GUMBO_TAG_UNKNOWN)
+        throw invalid_argument("Unknown tag name: " + name);
+      tags.set(tag);
+    }
+    return tags;
+  }
+
+  bool is_block_element(const GumboNode* node) {
+    return (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) &&
+      node->v.element.tag_namespace == GUMBO_NAMESPACE_HTML &&
+      node->v.element.tag < GUMBO_TAG_LAST &&
+      block_elements.test(node->v.element.tag);
+  }
+
+  string extract_text(const GumboNode* node, const string& separator, bool strip,
+    const TagSet& skip) {
+    string text;
+    text.reserve(estimate_text_size(node));
+    TextBuilder builder(text, separator, strip);
+    // The second member is true when the block element is being left
+    vector<pair<const GumboNode*, bool>> stack;
+    stack.emplace_back(node, false);
+    while (!stack.empty()) {
+      const GumboNode* current = stack.back().first;
+      bool leaving = stack.back().second;
+      stack.pop_back();
+      if (leaving) {
+        builder.block_boundary();
+        continue;
+      }
+      switch (current->type) {
+      case GUMBO_NODE_TEXT:
+      case GUMBO_NODE_CDATA:
+      case GUMBO_NODE_WHITESPACE:
+        builder.append(current->v.text.text, strlen(current->v.text.text));
+        break;
+      case GUMBO_NODE_COMMENT:
+        break;
+      case GUMBO_NODE_ELEMENT:
+      case GUMBO_NODE_TEMPLATE:
+        if (current != node && current->v.element.tag < GUMBO_TAG_LAST &&
+            skip.test(current->v.element.tag))
+          break;
+        // Fall through
+      case GUMBO_NODE_DOCUMENT: {
+        if (is_block_element(current)) {
+          builder.block_boundary();
+          stack.emplace_back(current, true);
+        }
+        const GumboVector* children = children_of(current);
+        for (size_t i = children->length; i > 0; --i)
+          stack.emplace_back(static_cast<GumboNode*>(children->data[i - 1]), false);
+        break;
+      }
+      }
+    }
+    return text;
+  }
+}
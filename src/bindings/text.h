@@ -0,0 +1,31 @@
+#pragma once
+
+#include <gumbo/gumbo.h>
+
+#include <bitset>
+#include <string>
+#include <vector>
+
+namespace gumbo_python {
+
+  /// A set of GumboTag enums
+  using TagSet = std::bitset<GUMBO_TAG_LAST>;
+
+  /// Build a TagSet from tag names. Throws std::invalid_argument on an unknown tag name.
+  TagSet make_tag_set(const std::vector<std::string>& tag_names);
+
+  /// True for HTML elements that start a new line of text when rendered
+  bool is_block_element(const GumboNode* node);
+
+  /**
+   * Extract the text content of a node and all its descendants.
+   *
+   * Text from different block-level elements (and either side of <br>) is joined
+   * with separator, while text from inline elements is concatenated as is.
+   * If strip is true, whitespace runs are collapsed to a single space and
+   * leading and trailing whitespace of each block is removed.
+   * The content of elements listed in skip is ignored, as are comments.
+   */
+  std::string extract_text(const GumboNode* node, const std::string& separator,
+    bool strip, const TagSet& skip);
+}
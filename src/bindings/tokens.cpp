@@ -0,0 +1,128 @@
+#include "tokens.h"
+
+#include <utility>
+
+using namespace std;
+
+namespace gumbo_python {
+
+  namespace {
+    inline bool is_character(GumboTokenType type) {
+      return type == GUMBO_TOKEN_CHARACTER || type == GUMBO_TOKEN_WHITESPACE ||
+        type == GUMBO_TOKEN_CDATA || type == GUMBO_TOKEN_NULL;
+    }
+
+    void append_utf8(string& text, int c) {
+      if (c < 0x80) {
+        text += static_cast<char>(c);
+      } else if (c < 0x800) {
+        text += static_cast<char>(0xC0 | (c >> 6));
+        text += static_cast<char>(0x80 | (c & 0x3F));
+      } else if (c < 0x10000) {
+        text += static_cast<char>(0xE0 | (c >> 12));
+        text += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (c & 0x3F));
+      } else {
+        text += static_cast<char>(0xF0 | (c >> 18));
+        text += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+        text += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (c & 0x3F));
+      }
+    }
+
+    /// Lowercase tag name from the original text of a start or end tag
+    string tag_name_of(const GumboToken& token) {
+      if (token.type == GUMBO_TOKEN_START_TAG ? token.v.start_tag.tag != GUMBO_TAG_UNKNOWN :
+          token.v.end_tag != GUMBO_TAG_UNKNOWN)
+        return gumbo_normalized_tagname(token.type == GUMBO_TOKEN_START_TAG ?
+          token.v.start_tag.tag : token.v.end_tag);
+      GumboStringPiece name = token.original_text;
+      gumbo_tag_from_original_text(&name);
+      string result;
+      for (size_t i = 0; i < name.length && name.data[i] != '>' && name.data[i] != '/'; ++i) {
+        char c = name.data[i];
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r')
+          break;
+        result += (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+      }
+      return result;
+    }
+  }
+
+  TokenStream::TokenStream(const char* html, size_t length) : source_(html) {
+    // Parse errors are not reported, so none are recorded
+    options_ = kGumboDefaultOptions;
+    options_.max_errors = 0;
+    gumbo_lexer_init(&lexer_, &options_, html, length);
+  }
+
+  bool TokenStream::read(Token& token) {
+    GumboToken lexer_token;
+    if (!gumbo_lexer_next(&lexer_, &lexer_token))
+      return false;
+    token.type = lexer_token.type;
+    token.tag = GUMBO_TAG_UNKNOWN;
+    token.name.clear();
+    token.attributes.clear();
+    token.text.clear();
+    token.offset = lexer_token.original_text.data - source_;
+    switch (lexer_token.type) {
+    case GUMBO_TOKEN_DOCTYPE:
+      token.name = lexer_token.v.doc_type.name;
+      break;
+    case GUMBO_TOKEN_START_TAG: {
+      token.tag = lexer_token.v.start_tag.tag;
+      token.name = tag_name_of(lexer_token);
+      const GumboVector& attributes = lexer_token.v.start_tag.attributes;
+      token.attributes.reserve(attributes.length);
+      for (size_t i = 0; i < attributes.length; ++i) {
+        const GumboAttribute* attr = static_cast<GumboAttribute*>(attributes.data[i]);
+        token.attributes.emplace_back(attr->name, attr->value);
+      }
+      break;
+    }
+    case GUMBO_TOKEN_END_TAG:
+      token.tag = lexer_token.v.end_tag;
+      token.name = tag_name_of(lexer_token);
+      break;
+    case GUMBO_TOKEN_COMMENT:
+      token.text = lexer_token.v.text;
+      break;
+    case GUMBO_TOKEN_NULL:
+      // Dropped from the text as the tree builder does
+      break;
+    case GUMBO_TOKEN_EOF:
+      gumbo_token_destroy(&lexer_token);
+      return false;
+    default:
+      append_utf8(token.text, lexer_token.v.character);
+      break;
+    }
+    gumbo_token_destroy(&lexer_token);
+    return true;
+  }
+
+  bool TokenStream::next(Token& token) {
+    if (has_pending_) {
+      has_pending_ = false;
+      swap(token, pending_);
+    } else if (!read(token)) {
+      return false;
+    }
+    if (!is_character(token.type))
+      return true;
+    if (token.type == GUMBO_TOKEN_NULL)
+      token.type = GUMBO_TOKEN_WHITESPACE;
+    bool is_cdata = token.type == GUMBO_TOKEN_CDATA;
+    while (read(pending_)) {
+      if (!is_character(pending_.type) || (pending_.type == GUMBO_TOKEN_CDATA) != is_cdata) {
+        has_pending_ = true;
+        break;
+      }
+      token.text += pending_.text;
+      if (pending_.type == GUMBO_TOKEN_CHARACTER)
+        token.type = GUMBO_TOKEN_CHARACTER;
+    }
+    return true;
+  }
+}
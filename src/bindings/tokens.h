@@ -0,0 +1,56 @@
+#pragma once
+
+#include <gumbo/lexer.h>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gumbo_python {
+
+  /// A token with its data copied out of the tokenizer
+  struct Token {
+    /// Runs of characters are merged into a single GUMBO_TOKEN_CHARACTER,
+    /// GUMBO_TOKEN_WHITESPACE (if all whitespace) or GUMBO_TOKEN_CDATA token.
+    GumboTokenType type;
+    /// Tag of start and end tags
+    GumboTag tag;
+    /// Tag name of start and end tags or the doctype name
+    std::string name;
+    /// Attributes of start tags in source order
+    std::vector<std::pair<std::string, std::string>> attributes;
+    /// Text of character runs and comments
+    std::string text;
+    /// Offset of the token in the source in bytes
+    size_t offset;
+  };
+
+  /**
+   * Splits HTML into tokens with the tokenizer only, without tree construction.
+   * The source must outlive the stream.
+   */
+  class TokenStream {
+  private:
+    GumboOptions options_;
+    GumboLexer lexer_;
+    const char* source_;
+    /// The token following a character run, read ahead to find the end of the run
+    Token pending_;
+    bool has_pending_ = false;
+
+    /// Read the next lexer token, returning false at EOF
+    bool read(Token& token);
+
+  public:
+    TokenStream(const char* html, size_t length);
+
+    ~TokenStream() { gumbo_lexer_destroy(&lexer_); }
+
+    TokenStream(const TokenStream&) = delete;
+    TokenStream& operator=(const TokenStream&) = delete;
+
+    /// Get the next token. Returns false once all tokens have been read.
+    bool next(Token& token);
+  };
+}
@@ -1,5 +1,16 @@
 #include "wrappers.h"
 
+#include "encoding.h"
+#include "escape.h"
+#include "executor.h"
+#include "pipeline.h"
+
+#include <gumbo/gumbo_edit.h>
+
+#include <atomic>
+#include <exception>
+#include <limits>
+
 namespace py = pybind11;
 using namespace std;
 
@@ -12,7 +23,7 @@ array<string, 3> tag_namespaces = {
   "http://www.w3.org/1998/Math/MathML"
 };
 
-std::unordered_map<const char*, GumboNamespaceEnum> tag_namespace_map = {
+unordered_map<string, GumboNamespaceEnum> tag_namespace_map = {
   {"html", GUMBO_NAMESPACE_HTML},
   {"svg", GUMBO_NAMESPACE_SVG},
   {"mathml", GUMBO_NAMESPACE_MATHML}
@@ -35,15 +46,27 @@ array<string, 4> attr_namespace_urls = {
 #pragma endregion
 
 #pragma region make_node
-  node_ptr make_node(GumboNode* node) {
+  bool Eviction::may_evict(const GumboNode* node) const {
+    for (; node; node = node->parent) {
+      if ((node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) &&
+          node->v.element.tag < GUMBO_TAG_LAST && tags[node->v.element.tag])
+        return true;
+    }
+    return false;
+  }
+
+  node_ptr make_node(GumboNode* node, const shared_ptr<const Eviction>& eviction) {
     if (!node)
       return nullptr;
-    else if (node->type == GUMBO_NODE_DOCUMENT)
+    EvictionCheck check;
+    if (eviction && eviction->may_evict(node))
+      check = EvictionCheck(eviction);
+    if (node->type == GUMBO_NODE_DOCUMENT)
       return std::make_unique<Document>(node);
     else if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE)
-      return std::make_unique<Tag>(node);
+      return std::make_unique<Tag>(node, move(check));
     else
-      return std::make_unique<Text>(node);
+      return std::make_unique<Text>(node, move(check));
   }
 #pragma endregion
 
@@ -54,17 +77,19 @@ array<string, 4> attr_namespace_urls = {
   }
 
   node_ptr NodeVector::next() {
+    check_();
     if (curr_index_ >= vector_->length)
       throw py::stop_iteration();
-    node_ptr node = make_node(static_cast<GumboNode*>(vector_->data[curr_index_]));
+    node_ptr node = make_node(static_cast<GumboNode*>(vector_->data[curr_index_]), check_.eviction());
     ++curr_index_;
     return node;
   }
 
-  node_ptr NodeVector::get_item(unsigned int idx) const {
+  node_ptr NodeVector::get_item(size_t idx) const {
+    check_();
     if (idx >= vector_->length)
       throw py::index_error(std::to_string(idx));
-    return make_node(static_cast<GumboNode*>(vector_->data[idx]));
+    return make_node(static_cast<GumboNode*>(vector_->data[idx]), check_.eviction());
   }
 #pragma endregion
 
@@ -75,27 +100,31 @@ array<string, 4> attr_namespace_urls = {
   }
 
   Attribute AttributeMap::next() {
+    check_();
     if (curr_index_ >= attrs_->length)
       throw py::stop_iteration();
     GumboAttribute* attr = static_cast<GumboAttribute*>(attrs_->data[curr_index_]);
     ++curr_index_;
-    return Attribute(attr);
+    return Attribute(attr, check_);
   }
 
   Attribute AttributeMap::get_item(const char* attr_name) const {
+    check_();
     GumboAttribute* attr = gumbo_get_attribute(attrs_, attr_name);
     if (!attr)
       throw py::key_error(attr_name);
-    return Attribute(attr);
+    return Attribute(attr, check_);
   }
 
   bool AttributeMap::contains(const char* attr_name) const {
+    check_();
     return gumbo_get_attribute(attrs_, attr_name) != nullptr;
   }
 
   py::dict AttributeMap::as_dict() const {
+    check_();
     py::dict attr_dict;
-    for (unsigned int i = 0; i < attrs_->length; ++i) {
+    for (size_t i = 0; i < attrs_->length; ++i) {
       GumboAttribute* attr = static_cast<GumboAttribute*>(attrs_->data[i]);
       attr_dict[attr->name] = attr->value;
     }
@@ -105,48 +134,784 @@ array<string, 4> attr_namespace_urls = {
 #pragma endregion
 
 #pragma region Node
-  unsigned int Node::offset() const {
-    if (node_->type == GUMBO_NODE_DOCUMENT)
+  size_t Node::offset() const {
+    GumboNode* node = this->node();
+    if (node->type == GUMBO_NODE_DOCUMENT)
       return 0;
-    else if (node_->type == GUMBO_NODE_ELEMENT || node_->type == GUMBO_NODE_TEMPLATE)
-      return node_->v.element.start_pos.offset;
+    else if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE)
+      return node->v.element.start_pos.offset;
     else
-      return node_->v.text.start_pos.offset;
+      return node->v.text.start_pos.offset;
+  }
+
+  string Node::get_text(const string& separator, bool strip, const vector<string>& skip) const {
+    TagSet skip_tags;
+    try {
+      skip_tags = make_tag_set(skip);
+    } catch (const invalid_argument& e) {
+      throw py::value_error(e.what());
+    }
+    return extract_text(node(), separator, strip, skip_tags);
+  }
+#pragma endregion
+
+#pragma region Tag
+  void Tag::set_attribute(const char* name, const char* value) {
+    gumbo_element_set_attribute(&node()->v.element, name, value);
+  }
+
+  void Tag::remove_attribute(const char* name) {
+    GumboElement* element = &node()->v.element;
+    GumboAttribute* attr = gumbo_get_attribute(&element->attributes, name);
+    if (!attr)
+      throw py::key_error(name);
+    gumbo_element_remove_attribute(element, attr);
+  }
+
+  void Tag::insert_text(const char* text, int index) {
+    check_();
+    if (index < -1 || (index >= 0 && static_cast<size_t>(index) > children_->length))
+      throw py::index_error(std::to_string(index));
+    if (static_cast<size_t>(index) == children_->length)
+      index = -1;
+    gumbo_insert_node(gumbo_create_text_node(GUMBO_NODE_TEXT, text), node(), index);
   }
 #pragma endregion
 
 #pragma region Text
   string Text::str() const {
-    string str{ node_->v.text.text };
-    if (node_->type == GUMBO_NODE_TEXT)
+    GumboNode* node = this->node();
+    string str{ node->v.text.text };
+    if (node->type == GUMBO_NODE_TEXT)
       return str;
-    else if (node_->type == GUMBO_NODE_WHITESPACE)
+    else if (node->type == GUMBO_NODE_WHITESPACE)
       return "<Whitespace '" + str + "'>";
-    else if (node_->type == GUMBO_NODE_COMMENT)
+    else if (node->type == GUMBO_NODE_COMMENT)
       return "<!--" + str + "-->";     
     else
       return "<![CDATA[" + str + "]]>";
   }
 #pragma endregion
 
+#pragma region Visitor
+  Visitor::Visitor(py::object visitor, py::handle tags, py::handle evict_tags)
+    : start_(py::getattr(visitor, "start", py::none())), end_(py::getattr(visitor, "end", py::none())) {
+    if (tags.is_none()) {
+      tags_.set();
+      tags_.reset(GUMBO_TAG_UNKNOWN);
+    } else {
+      try {
+        tags_ = make_tag_set(tags.cast<vector<string>>());
+      } catch (const invalid_argument& e) {
+        throw py::value_error(e.what());
+      }
+    }
+    if (evict_tags.is_none())
+      return;
+    TagSet evicted;
+    try {
+      evicted = make_tag_set(evict_tags.cast<vector<string>>());
+    } catch (const invalid_argument& e) {
+      throw py::value_error(e.what());
+    }
+    if ((evicted & ~tags_).any())
+      throw py::value_error("evict_tags must be a subset of visitor_tags");
+    if (end_.is_none())
+      throw py::value_error("evict_tags needs a visitor with an end method");
+    eviction_ = make_shared<Eviction>();
+    for (size_t tag = 0; tag < eviction_->tags.size(); ++tag)
+      eviction_->tags[tag] = evicted.test(tag);
+  }
+
+  void Visitor::notify(const py::object& method, GumboNode* element) {
+    if (has_evicted_) {
+      // The elements ended so far are freed after their tokens, which may have passed
+      ++eviction_->generation;
+      has_evicted_ = false;
+    }
+    if (error_ || is_stopped_ || method.is_none() || element->v.element.tag >= GUMBO_TAG_LAST ||
+        !tags_.test(element->v.element.tag))
+      return;
+    try {
+      py::object result = method(make_node(element, eviction_));
+      is_stopped_ = result.is(py::bool_(true));
+    } catch (py::error_already_set& e) {
+      // Exceptions can't propagate through the C parser, so the error is raised after parsing
+      error_ = make_unique<py::error_already_set>(move(e));
+    }
+  }
+
+  void Visitor::element_start(void* visitor, GumboNode* element) {
+    Visitor* self = static_cast<Visitor*>(visitor);
+    self->notify(self->start_, element);
+  }
+
+  void Visitor::element_end(void* visitor, GumboNode* element) {
+    Visitor* self = static_cast<Visitor*>(visitor);
+    self->notify(self->end_, element);
+    Eviction* eviction = self->eviction_.get();
+    if (!eviction)
+      return;
+    GumboTag tag = element->v.element.tag;
+    if (tag < GUMBO_TAG_LAST && eviction->tags[tag])
+      self->has_evicted_ = true;
+    // Once the visitor gets no more elements, none are evicted without it seeing them
+    if (self->error_ || self->is_stopped_)
+      eviction->tags.fill(false);
+  }
+
+  bool Visitor::should_stop(void* visitor, size_t) {
+    Visitor* self = static_cast<Visitor*>(visitor);
+    return self->is_stopped_ || self->error_;
+  }
+
+  void Visitor::set_callbacks(GumboOptions& options) {
+    options.element_start = &Visitor::element_start;
+    options.element_end = &Visitor::element_end;
+    options.should_stop = &Visitor::should_stop;
+    options.userdata = this;
+    if (eviction_)
+      options.evict_tags = eviction_->tags.data();
+  }
+
+  void Visitor::check() const {
+    if (error_)
+      throw *error_;
+  }
+#pragma endregion
+
+#pragma region FragmentContext
+  FragmentContext::FragmentContext(const char* container, const char* container_namespace) {
+    tag = gumbo_tag_enum(container);
+    if (tag == GUMBO_TAG_UNKNOWN)
+      throw py::value_error("Unknown container tag: " + string(container));
+    auto it = tag_namespace_map.find(container_namespace);
+    if (it == tag_namespace_map.end())
+      throw py::value_error("Unknown namespace: " + string(container_namespace));
+    tag_namespace = it->second;
+  }
+#pragma endregion
+
 #pragma region Output
-  Output::Output(const char* html, const char* fragment_ctx, const char* fragment_namespace) {
-      output_ = gumbo_parse_fragment(&kGumboDefaultOptions, html, strlen(html),
-        gumbo_tag_enum(fragment_ctx),
-        tag_namespace_map[fragment_namespace]);
+  namespace {
+    /// Set by set_background_destroy. Only accessed with the GIL held.
+    bool is_background_destroy = false;
+
+    /// A single thread that frees parse trees dropped by Output objects
+    ThreadPool& reclaim_pool() {
+      static ThreadPool pool(1);
+      return pool;
+    }
+
+    /// Set by set_cpu_count, 0 for the number of cores the system reports
+    atomic<unsigned> cpu_count{0};
+
+    /// A second thread for the tokenizer only helps if it gets a core of its own
+    GumboOutput* parse_with_options(const GumboOptions& options, const char* html, size_t length,
+      bool pipeline, size_t chunk_size) {
+      unsigned cores = cpu_count.load(memory_order_relaxed);
+      if (!cores)
+        cores = thread::hardware_concurrency();
+      if (cores > 1 && chunk_size && length > chunk_size)
+        return parse_chunked(options, html, length, chunk_size, cores - 1);
+      if (pipeline && cores > 1)
+        return parse_pipelined(options, html, length);
+      return gumbo_parse_with_options(&options, html, length);
+    }
+  }
+
+  void set_background_destroy(bool enabled) {
+    is_background_destroy = enabled;
+  }
+
+  void set_cpu_count(unsigned count) {
+    cpu_count.store(count, memory_order_relaxed);
+  }
+
+  HtmlSource::HtmlSource(py::handle html) {
+    if (PyUnicode_Check(html.ptr())) {
+      bytes_ = py::reinterpret_steal<py::object>(PyUnicode_AsUTF8String(html.ptr()));
+    } else if (PyBytes_Check(html.ptr())) {
+      bytes_ = py::reinterpret_borrow<py::object>(html);
+    } else if (PyObject_CheckBuffer(html.ptr())) {
+      // Read-only buffers like mmap are parsed in place. Writable ones may change under the
+      // tree, so they are copied, as are non-contiguous ones.
+      if (PyObject_GetBuffer(html.ptr(), &view_, PyBUF_SIMPLE) == 0) {
+        if (view_.readonly) {
+          has_view_ = true;
+          data_ = static_cast<const char*>(view_.buf);
+          length_ = view_.len;
+          return;
+        }
+        PyBuffer_Release(&view_);
+      } else {
+        PyErr_Clear();
+      }
+      bytes_ = py::reinterpret_steal<py::object>(PyBytes_FromObject(html.ptr()));
+    } else {
+      throw py::type_error("HTML must be str, bytes or a bytes-like object");
+    }
+    if (!bytes_)
+      throw py::error_already_set();
+    data_ = PyBytes_AS_STRING(bytes_.ptr());
+    length_ = PyBytes_GET_SIZE(bytes_.ptr());
+  }
+
+  HtmlSource::HtmlSource(HtmlSource&& other) noexcept
+    : bytes_(move(other.bytes_)), view_(other.view_), has_view_(other.has_view_),
+      data_(other.data_), length_(other.length_) {
+    other.has_view_ = false;
+  }
+
+  HtmlSource::~HtmlSource() {
+    if (has_view_)
+      PyBuffer_Release(&view_);
+  }
+
+  namespace {
+    bool is_known_encoding(const string& encoding) {
+      return encoding == "utf-8" || is_native_encoding(encoding) ||
+        PyCodec_KnownEncoding(codec_name(encoding).c_str());
+    }
+  }
+
+  HtmlSource decode_html(py::handle html, const char* encoding, const char* transport_encoding) {
+    if (PyUnicode_Check(html.ptr())) {
+      if (encoding || transport_encoding)
+        throw py::type_error("encoding can't be given for str HTML");
+      return HtmlSource(html);
+    }
+    HtmlSource bytes(html);
+    const char* data = bytes.data();
+    size_t length = bytes.length();
+    size_t bom_length = 0;
+    string name;
+    if (encoding) {
+      name = normalize_encoding(encoding);
+      if (!is_known_encoding(name)) {
+        PyErr_Format(PyExc_LookupError, "unknown encoding: %s", encoding);
+        throw py::error_already_set();
+      }
+      if (sniff_bom(data, length, bom_length) != name)
+        bom_length = 0;
+    } else {
+      name = sniff_encoding(data, length, transport_encoding ? transport_encoding : "",
+        is_known_encoding, bom_length);
+    }
+    data += bom_length;
+    length -= bom_length;
+    if (name == "utf-8")
+      return bom_length ? HtmlSource(py::bytes(data, length)) : move(bytes);
+    if (is_native_encoding(name)) {
+      // Decode straight into the bytes object that the parser reads
+      py::object text = py::reinterpret_steal<py::object>(
+        PyBytes_FromStringAndSize(nullptr, decoded_length(name, data, length)));
+      if (!text)
+        throw py::error_already_set();
+      decode_to_utf8(name, data, length, PyBytes_AS_STRING(text.ptr()));
+      return HtmlSource(text);
     }
+    py::object text = py::reinterpret_steal<py::object>(
+      PyUnicode_Decode(data, length, codec_name(name).c_str(), "replace"));
+    if (!text)
+      throw py::error_already_set();
+    return HtmlSource(text);
+  }
+
+  Output::~Output() {
+    if (line_index_)
+      gumbo_destroy_line_index(line_index_);
+    // original_text and original_tag in the tree still point into source_, which may be
+    // released before the tree is freed. That is safe only because freeing the nodes
+    // never reads those pieces.
+    GumboOutput* output = output_;
+    vector<RemovedNode> removed = move(removed_);
+    auto destroy = [output, removed] {
+      for (const RemovedNode& node : removed)
+        gumbo_destroy_node(const_cast<GumboNode*>(node.node));
+      gumbo_destroy_output(output);
+    };
+    if (is_background_destroy && reclaim_pool().submit(destroy))
+      return;
+    destroy();
+  }
+
+  Output::Output(HtmlSource source, const GumboOptions& options, bool pipeline, size_t chunk_size)
+    : source_(move(source)), html_(source_.data()), length_(source_.length()) {
+    output_ = parse_with_options(options, html_, length_, pipeline, chunk_size);
+  }
+
+  Output::Output(HtmlSource source, GumboOutput* output)
+    : source_(move(source)), html_(source_.data()), length_(source_.length()), output_(output) {}
+
+  Output::Output(py::handle html, const char* fragment_ctx, const char* fragment_namespace)
+    : source_(html), html_(source_.data()), length_(source_.length()) {
+    FragmentContext context(fragment_ctx, fragment_namespace);
+    output_ = gumbo_parse_fragment(&kGumboDefaultOptions, html_, length_,
+      context.tag, context.tag_namespace);
+  }
+
+  py::bytes Output::to_html(bool pretty, bool preserve) const {
+    if (!preserve)
+      return serialize(output_->document, pretty);
+    if (pretty)
+      throw py::value_error("pretty and preserve can't be used together");
+    return serialize_preserving(output_->document, html_, length_, removed_);
+  }
+
+  void Output::remove(const Node& node) {
+    GumboNode* removed = node.node();
+    GumboNode* root = removed;
+    while (root->parent)
+      root = root->parent;
+    if (root != output_->document || removed == root)
+      throw py::value_error("node is not in the tree");
+    GumboNode* parent = removed->parent;
+    gumbo_remove_from_parent(removed);
+    removed_.push_back(RemovedNode{ removed, parent });
+  }
+
+  py::tuple Output::position(size_t offset) const {
+    if (offset > length_)
+      throw py::value_error("offset is out of range: " + to_string(offset));
+    if (!line_index_)
+      line_index_ = gumbo_create_line_index(&kGumboDefaultOptions, html_, length_);
+    GumboSourcePosition position = {0, 0, offset};
+    gumbo_compute_position(line_index_, &position);
+    return py::make_tuple(position.line, position.column);
+  }
+
+  py::list Output::links(const char* base_url) const {
+    vector<Link> links = extract_links(output_->document, base_url ? base_url : "");
+    py::list result;
+    for (const Link& link : links) {
+      py::object resolved_url = py::none();
+      if (link.is_resolved)
+        resolved_url = py::str(link.resolved_url);
+      result.append(py::make_tuple(gumbo_normalized_tagname(link.tag), link.attribute,
+        link.raw_url, resolved_url, link.offset));
+    }
+    return result;
+  }
+#pragma endregion
+
+#pragma region Rewriter
+  namespace {
+    /// Size of the chunks passed to the write callback of Rewriter.rewrite
+    const size_t rewrite_chunk_size = 64 * 1024;
+
+    template <typename Function>
+    void add_rewrite_rule(Function add) {
+      try {
+        add();
+      } catch (const invalid_argument& e) {
+        throw py::value_error(e.what());
+      }
+    }
+  }
+
+  void Rewriter::set_attribute(const string& selector, string name, string value) {
+    add_rewrite_rule([&] { rewriter_.set_attribute(selector, move(name), move(value)); });
+  }
+
+  void Rewriter::remove_attribute(const string& selector, string name) {
+    add_rewrite_rule([&] { rewriter_.remove_attribute(selector, move(name)); });
+  }
+
+  void Rewriter::rewrite_attribute(const string& selector, string name, py::function callback) {
+    StreamRewriter::AttributeCallback rewrite = [callback](const string& value, string& result) {
+      py::object new_value = callback(value);
+      if (new_value.is_none())
+        return false;
+      result = new_value.cast<string>();
+      return true;
+    };
+    add_rewrite_rule([&] { rewriter_.rewrite_attribute(selector, move(name), move(rewrite)); });
+  }
+
+  void Rewriter::remove(const string& selector) {
+    add_rewrite_rule([&] { rewriter_.remove(selector); });
+  }
+
+  void Rewriter::before(const string& selector, string html) {
+    add_rewrite_rule([&] { rewriter_.before(selector, move(html)); });
+  }
+
+  void Rewriter::after(const string& selector, string html) {
+    add_rewrite_rule([&] { rewriter_.after(selector, move(html)); });
+  }
+
+  py::object Rewriter::rewrite(py::handle html, py::object write) const {
+    HtmlSource source(html);
+    const char* data = source.data();
+    size_t length = source.length();
+    if (write.is_none())
+      return py::bytes(rewriter_.rewrite(data, length));
+    rewriter_.rewrite(data, length, [&write](const char* chunk, size_t chunk_length) {
+      write(py::bytes(chunk, chunk_length));
+    }, rewrite_chunk_size);
+    return py::none();
+  }
+#pragma endregion
+
+#pragma region TokenIterator
+  TokenIterator::TokenIterator(py::handle html)
+    : source_(html), stream_(make_unique<TokenStream>(source_.data(), source_.length())) {}
+
+  py::tuple TokenIterator::next() {
+    if (!stream_->next(token_))
+      throw py::stop_iteration();
+    py::object tag = py::none(), name = py::none(), attributes = py::none(), text = py::none();
+    switch (token_.type) {
+    case GUMBO_TOKEN_DOCTYPE:
+      name = py::str(token_.name);
+      break;
+    case GUMBO_TOKEN_START_TAG: {
+      py::list attribute_list;
+      for (const auto& attribute : token_.attributes)
+        attribute_list.append(py::make_tuple(attribute.first, attribute.second));
+      attributes = attribute_list;
+    }
+    // fall through
+    case GUMBO_TOKEN_END_TAG:
+      tag = py::int_(static_cast<int>(token_.tag));
+      name = py::str(token_.name);
+      break;
+    default:
+      text = py::str(token_.text);
+      break;
+    }
+    return py::make_tuple(token_.type, tag, name, attributes, text, token_.offset);
+  }
+#pragma endregion
+
+#pragma region tags
+  const char* tag_name(int tag) {
+    if (tag < 0 || tag >= GUMBO_TAG_LAST)
+      throw py::value_error("invalid tag: " + to_string(tag));
+    return gumbo_normalized_tagname(static_cast<GumboTag>(tag));
+  }
+
+  int tag_enum(const string& name) {
+    return gumbo_tagn_enum(name.data(), static_cast<int>(name.size()));
+  }
+#pragma endregion
+
+#pragma region escape
+  namespace {
+    /// Get the UTF-8 representation of a str. It is cached in the str object, ASCII strings are used as is.
+    const char* utf8_data(py::str text, Py_ssize_t& length) {
+      const char* data = PyUnicode_AsUTF8AndSize(text.ptr(), &length);
+      if (!data)
+        throw py::error_already_set();
+      return data;
+    }
+
+    py::str utf8_str(const string& text) {
+      PyObject* result = PyUnicode_DecodeUTF8(text.data(), text.size(), nullptr);
+      if (!result)
+        throw py::error_already_set();
+      return py::reinterpret_steal<py::str>(result);
+    }
+  }
+
+  py::str escape(py::str text, bool quote) {
+    Py_ssize_t length;
+    const char* data = utf8_data(text, length);
+    size_t start = find_escaped(data, length, quote);
+    if (start == static_cast<size_t>(length))
+      return text;
+    string escaped(data, start);
+    escaped.reserve(length + length / 8 + 8);
+    escape_html(data + start, length - start, quote, escaped);
+    return utf8_str(escaped);
+  }
+
+  py::str unescape(py::str text) {
+    Py_ssize_t length = PyUnicode_GET_LENGTH(text.ptr());
+    if (PyUnicode_FindChar(text.ptr(), '&', 0, length, 1) == -1)
+      return text;
+    const char* data = utf8_data(text, length);
+    string unescaped;
+    unescaped.reserve(length);
+    unescape_html(data, length, unescaped);
+    return utf8_str(unescaped);
+  }
+#pragma endregion
+
+#pragma region tokenize
+  unique_ptr<TokenIterator> tokenize(py::handle html) {
+    return make_unique<TokenIterator>(html);
+  }
 #pragma endregion
 
 #pragma region parse;
-  unique_ptr<Output> parse(const char* html) {
-    return make_unique<Output>(html);
-}
+  namespace {
+    /// Convert a limit argument of parse to a GumboOptions limit of type T, -1 for None
+    template <typename T>
+    T limit_option(py::handle value, const char* name) {
+      if (value.is_none())
+        return -1;
+      py::object index = py::reinterpret_steal<py::object>(PyNumber_Index(value.ptr()));
+      if (!index)
+        throw py::error_already_set();
+      int overflow;
+      long long limit = PyLong_AsLongLongAndOverflow(index.ptr(), &overflow);
+      if (limit == -1 && PyErr_Occurred())
+        throw py::error_already_set();
+      if (overflow < 0 || limit < 0)
+        throw py::value_error(string(name) + " must not be negative");
+      if (overflow > 0 || static_cast<unsigned long long>(limit) > numeric_limits<T>::max())
+        throw py::value_error(string(name) + " must not be greater than " +
+          to_string(numeric_limits<T>::max()));
+      return static_cast<T>(limit);
+    }
+
+    const char* const timeout_message = "HTML parsing timed out";
+
+    void check_timeout(const Output& output) {
+      if (output.status() == GUMBO_STATUS_CANCELLED) {
+        PyErr_SetString(PyExc_TimeoutError, timeout_message);
+        throw py::error_already_set();
+      }
+    }
+  }
+
+  ParseOptions::ParseOptions(const char* stop_after, py::handle prune_tags, bool drop_whitespace,
+    bool drop_comments, py::handle max_tree_depth, py::handle max_nodes,
+    py::handle max_text_length, py::handle max_attribute_length,
+    py::handle max_attributes, py::handle timeout) {
+    options_.drop_whitespace = drop_whitespace;
+    options_.drop_comments = drop_comments;
+    options_.max_tree_depth = limit_option<int>(max_tree_depth, "max_tree_depth");
+    options_.max_nodes = limit_option<int>(max_nodes, "max_nodes");
+    options_.max_text_length = limit_option<ptrdiff_t>(max_text_length, "max_text_length");
+    options_.max_attribute_length = limit_option<ptrdiff_t>(max_attribute_length,
+      "max_attribute_length");
+    options_.max_attributes = limit_option<int>(max_attributes, "max_attributes");
+    if (stop_after) {
+      options_.stop_after = gumbo_tag_enum(stop_after);
+      if (options_.stop_after == GUMBO_TAG_UNKNOWN)
+        throw py::value_error(string("Unknown tag name: ") + stop_after);
+    }
+    if (!prune_tags.is_none()) {
+      TagSet tags;
+      try {
+        tags = make_tag_set(prune_tags.cast<vector<string>>());
+      } catch (const invalid_argument& e) {
+        throw py::value_error(e.what());
+      }
+      for (size_t tag = 0; tag < prune_tags_.size(); ++tag)
+        prune_tags_[tag] = tags.test(tag);
+      options_.prune_tags = prune_tags_.data();
+    }
+    if (!timeout.is_none()) {
+      chrono::duration<double> seconds(timeout.cast<double>());
+      if (!(seconds.count() >= 0))
+        throw py::value_error("timeout must be a non-negative number");
+      // Timeouts the clock can't represent, such as inf, never expire. Half the range leaves
+      // room for the current time in the deadline.
+      chrono::duration<double> max_seconds(chrono::steady_clock::duration::max());
+      if (seconds < max_seconds / 2) {
+        has_timeout_ = true;
+        timeout_ = chrono::duration_cast<chrono::steady_clock::duration>(seconds);
+        options_.is_cancelled = is_cancelled;
+        options_.cancel_userdata = this;
+      }
+    }
+  }
+
+  bool ParseOptions::is_cancelled(void* options, size_t) {
+    return chrono::steady_clock::now() >= static_cast<ParseOptions*>(options)->deadline_;
+  }
+
+  GumboOptions& ParseOptions::start() {
+    if (has_timeout_) {
+      chrono::steady_clock::time_point now = chrono::steady_clock::now();
+      deadline_ = timeout_ < chrono::steady_clock::time_point::max() - now ?
+        now + timeout_ : chrono::steady_clock::time_point::max();
+    }
+    return options_;
+  }
+
+  unique_ptr<Output> parse(py::handle html, py::object visitor, py::handle visitor_tags,
+    const char* stop_after, py::handle prune_tags, bool drop_whitespace, bool drop_comments,
+    py::handle max_tree_depth, py::handle max_nodes, py::handle max_text_length,
+    py::handle max_attribute_length, py::handle max_attributes, py::handle timeout,
+    const char* encoding, const char* transport_encoding, bool pipeline, size_t chunk_size,
+    py::handle evict_tags) {
+    if (visitor.is_none() && !evict_tags.is_none())
+      throw py::value_error("evict_tags needs a visitor");
+    HtmlSource source = decode_html(html, encoding, transport_encoding);
+    ParseOptions parse_options(stop_after, prune_tags, drop_whitespace, drop_comments,
+      max_tree_depth, max_nodes, max_text_length, max_attribute_length, max_attributes, timeout);
+    unique_ptr<Output> output;
+    if (visitor.is_none()) {
+      output = make_unique<Output>(move(source), parse_options.start(), pipeline, chunk_size);
+    } else {
+      Visitor element_visitor(visitor, visitor_tags, evict_tags);
+      GumboOptions& options = parse_options.start();
+      element_visitor.set_callbacks(options);
+      output = make_unique<Output>(move(source), options, pipeline, chunk_size);
+      element_visitor.check();
+    }
+    check_timeout(*output);
+    return output;
+  }
+#pragma endregion
+
+#pragma region parse_in_background
+  namespace {
+    ThreadPool& background_pool() {
+      static ThreadPool pool;
+      return pool;
+    }
+
+    /// Raise the C++ exception being handled as a Python error, like pybind11 does for calls
+    void set_python_error() {
+      try {
+        throw;
+      } catch (py::error_already_set& e) {
+        e.restore();
+      } catch (const py::builtin_exception& e) {
+        e.set_error();
+      } catch (const bad_alloc&) {
+        PyErr_NoMemory();
+      } catch (const exception& e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+      } catch (...) {
+        PyErr_SetString(PyExc_RuntimeError, "Unknown error in background parsing");
+      }
+    }
+
+    /// Take the raised Python error as an exception object
+    py::object fetch_python_error() {
+      PyObject* type;
+      PyObject* value;
+      PyObject* traceback;
+      PyErr_Fetch(&type, &value, &traceback);
+      PyErr_NormalizeException(&type, &value, &traceback);
+      if (traceback)
+        PyException_SetTraceback(value, traceback);
+      Py_XDECREF(type);
+      Py_XDECREF(traceback);
+      return py::reinterpret_steal<py::object>(value);
+    }
+
+    /// A parse queued on the background pool. Its Python objects are only touched with the GIL held.
+    struct BackgroundParse {
+      HtmlSource source;
+      py::function done;
+      unique_ptr<ParseOptions> options;
+      bool pipeline;
+      size_t chunk_size;
+
+      /**
+       * Runs on a pool thread without the GIL. Nothing may escape to the pool, which would
+       * terminate, so failures are passed to done as the error.
+       */
+      void run() {
+        GumboOutput* output = nullptr;
+        exception_ptr failure;
+        try {
+          output = parse_with_options(options->start(), source.data(), source.length(), pipeline,
+            chunk_size);
+        } catch (...) {
+          // Pipelined and chunked parses start threads, which may fail
+          failure = current_exception();
+        }
+        py::gil_scoped_acquire gil;
+        unique_ptr<BackgroundParse> self(this);
+        py::object result = py::none();
+        py::object error = py::none();
+        try {
+          if (failure)
+            rethrow_exception(failure);
+          unique_ptr<Output> parsed;
+          try {
+            parsed = make_unique<Output>(move(source), output);
+          } catch (...) {
+            gumbo_destroy_output(output);
+            throw;
+          }
+          if (parsed->status() == GUMBO_STATUS_CANCELLED) {
+            error = py::reinterpret_steal<py::object>(
+              PyObject_CallFunction(PyExc_TimeoutError, "s", timeout_message));
+            if (!error)
+              throw py::error_already_set();
+          } else {
+            result = py::cast(move(parsed));
+          }
+        } catch (...) {
+          set_python_error();
+          error = fetch_python_error();
+        }
+        try {
+          done(result, error);
+        } catch (...) {
+          // Nothing can catch it on the pool thread, so report it like an
+          // exception in a __del__ method.
+          set_python_error();
+          PyErr_WriteUnraisable(done.ptr());
+        }
+      }
+    };
+  }
+
+  void parse_in_background(py::handle html, py::function done, const char* stop_after,
+    py::handle prune_tags, bool drop_whitespace, bool drop_comments,
+    py::handle max_tree_depth, py::handle max_nodes, py::handle max_text_length,
+    py::handle max_attribute_length, py::handle max_attributes, py::handle timeout,
+    const char* encoding, const char* transport_encoding, bool pipeline, size_t chunk_size) {
+    unique_ptr<BackgroundParse> parse(new BackgroundParse{
+      decode_html(html, encoding, transport_encoding), move(done),
+      make_unique<ParseOptions>(stop_after, prune_tags, drop_whitespace, drop_comments,
+        max_tree_depth, max_nodes, max_text_length, max_attribute_length, max_attributes, timeout),
+      pipeline, chunk_size});
+    BackgroundParse* task = parse.get();
+    if (!background_pool().submit([task] { task->run(); }))
+      throw runtime_error("Background parsing has been shut down");
+    parse.release();
+  }
+
+  void shutdown_background_threads() {
+    // Queued parses need the GIL to deliver their results
+    py::gil_scoped_release release;
+    background_pool().shutdown();
+    // Trees dropped from now on are freed on the calling thread
+    reclaim_pool().shutdown();
+  }
 #pragma endregion
 
 #pragma region parse_fragment
-  unique_ptr<Output> parse_fragment(const char* html, const char* container,
+  unique_ptr<Output> parse_fragment(py::handle html, const char* container,
     const char* fragment_namespace) {
     return make_unique<Output>(html, container, fragment_namespace);
   }
 #pragma endregion
+
+#pragma region Parser
+  Parser::Parser() : parser_(gumbo_create_parser()) {
+    if (!parser_)
+      throw bad_alloc();
+  }
+
+  unique_ptr<Output> Parser::parse_with_context(py::handle html, GumboTag tag,
+    GumboNamespaceEnum tag_namespace) {
+    HtmlSource source(html);
+    GumboOutput* output = gumbo_parser_parse_fragment(parser_, &kGumboDefaultOptions,
+      source.data(), source.length(), tag, tag_namespace);
+    return make_unique<Output>(move(source), output);
+  }
+
+  unique_ptr<Output> Parser::parse(py::handle html) {
+    return parse_with_context(html, GUMBO_TAG_LAST, GUMBO_NAMESPACE_HTML);
+  }
+
+  unique_ptr<Output> Parser::parse_fragment(py::handle html, const char* container,
+    const char* fragment_namespace) {
+    FragmentContext context(container, fragment_namespace);
+    return parse_with_context(html, context.tag, context.tag_namespace);
+  }
+#pragma endregion
 }
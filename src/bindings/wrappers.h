@@ -3,18 +3,27 @@
 #include <gumbo/gumbo.h>
 #include <pybind11/pybind11.h>
 
+#include "links.h"
+#include "rewriter.h"
+#include "serializer.h"
+#include "text.h"
+#include "tokens.h"
+
 #include <string>
 #include <unordered_map>
 #include <array>
+#include <chrono>
 #include <memory>
+#include <vector>
 #include <regex>
 #include <functional>
+#include <stdexcept>
 
 namespace gumbo_python {
 
   extern std::array<std::string, 3> tag_namespaces;
 
-  extern std::unordered_map<const char*, GumboNamespaceEnum> tag_namespace_map;
+  extern std::unordered_map<std::string, GumboNamespaceEnum> tag_namespace_map;
 
   extern std::array<std::string, 4> attr_namespace_values;
 
@@ -24,15 +33,51 @@ namespace gumbo_python {
 
   using node_ptr = std::unique_ptr<Node>;
 
-  node_ptr make_node(GumboNode* node);
+  /// Elements that the evict_tags option of a Visitor frees while parsing
+  struct Eviction {
+    std::array<bool, GUMBO_TAG_LAST> tags{};
+    /// Bumped whenever elements may have been freed since the last bump
+    size_t generation = 0;
+
+    /// True if the node or an element it is in has one of the tags
+    bool may_evict(const GumboNode* node) const;
+  };
+
+  /**
+   * Makes a wrapper of a node that may be evicted raise ValueError once the eviction
+   * generation changes, instead of reading freed memory. Does nothing for other nodes.
+   */
+  class EvictionCheck {
+  private:
+    std::shared_ptr<const Eviction> eviction_;
+    size_t generation_ = 0;
+
+  public:
+    EvictionCheck() = default;
+    explicit EvictionCheck(std::shared_ptr<const Eviction> eviction)
+      : eviction_(std::move(eviction)), generation_(eviction_->generation) {}
+
+    const std::shared_ptr<const Eviction>& eviction() const { return eviction_; }
+
+    /// Raise ValueError if the node may have been evicted
+    void operator()() const {
+      if (eviction_ && eviction_->generation != generation_)
+        throw pybind11::value_error("node has been evicted from the tree");
+    }
+  };
+
+  /// Nodes that eviction may free get an EvictionCheck
+  node_ptr make_node(GumboNode* node, const std::shared_ptr<const Eviction>& eviction = nullptr);
 
   class NodeVector {
   private:
     GumboVector* vector_;
-    unsigned int curr_index_ = 0;
+    EvictionCheck check_;
+    size_t curr_index_ = 0;
 
   public:
-    explicit NodeVector(GumboVector* vector) : vector_(vector) {}
+    explicit NodeVector(GumboVector* vector, EvictionCheck check = EvictionCheck())
+      : vector_(vector), check_(std::move(check)) {}
 
     /// For Python __iter__ method
     NodeVector* iter();
@@ -41,35 +86,39 @@ namespace gumbo_python {
     node_ptr next();
 
     /// Get an item from NodeVector by index
-    node_ptr get_item(unsigned int index) const;
+    node_ptr get_item(size_t index) const;
 
     /// Get NodeVector length
-    unsigned int len() const { return vector_->length; }
+    size_t len() const { check_(); return vector_->length; }
   };
 
   class Attribute {
   private:
     GumboAttribute* attr_;
+    EvictionCheck check_;
 
   public:
-    explicit Attribute(GumboAttribute* attr) : attr_(attr) {}
+    explicit Attribute(GumboAttribute* attr, EvictionCheck check = EvictionCheck())
+      : attr_(attr), check_(std::move(check)) {}
 
-    const char* name() const { return attr_->name; }
+    const char* name() const { check_(); return attr_->name; }
 
-    const char* value() const { return attr_->value; }
+    const char* value() const { check_(); return attr_->value; }
 
-    int attr_namespace() const { return attr_->attr_namespace; }
+    int attr_namespace() const { check_(); return attr_->attr_namespace; }
 
-    std::string str() const { return "<Attribute " + std::string(attr_->name) + " = \"" + attr_->value + "\">"; }
+    std::string str() const { check_(); return "<Attribute " + std::string(attr_->name) + " = \"" + attr_->value + "\">"; }
   };
 
   class AttributeMap {
   private:
     GumboVector* attrs_;
-    unsigned int curr_index_ = 0;
+    EvictionCheck check_;
+    size_t curr_index_ = 0;
 
   public:
-    explicit AttributeMap(GumboVector* attrs) : attrs_(attrs) {}
+    explicit AttributeMap(GumboVector* attrs, EvictionCheck check = EvictionCheck())
+      : attrs_(attrs), check_(std::move(check)) {}
 
     AttributeMap* iter();
 
@@ -81,19 +130,28 @@ namespace gumbo_python {
 
     pybind11::dict as_dict() const;
 
-    unsigned int len() const { return attrs_->length; }
+    size_t len() const { check_(); return attrs_->length; }
   };
 
   class Node {
-  protected:
+  private:
     GumboNode* node_;
 
+    friend class Output;
+
+  protected:
+    EvictionCheck check_;
+
+    /// Get the wrapped node, raising ValueError if it may have been evicted
+    GumboNode* node() const { check_(); return node_; }
+
   public:
-    explicit Node(GumboNode* node) : node_(node) {}
+    explicit Node(GumboNode* node, EvictionCheck check = EvictionCheck())
+      : node_(node), check_(std::move(check)) {}
     virtual ~Node() {};
 
     /// Get node's parent
-    node_ptr parent() const { return make_node(node_->parent); }
+    node_ptr parent() const { return make_node(node()->parent, check_.eviction()); }
 
     virtual bool is_tag() const { return false; }
 
@@ -101,13 +159,20 @@ namespace gumbo_python {
     virtual std::string str() const { return ""; }
 
     /// Get node type as int
-    int type() const { return node_->type; }
+    int type() const { return node()->type; }
 
     /// Get node offset
-    unsigned int offset() const;
+    size_t offset() const;
 
     /// Get node index within parent
-    size_t index_within_parent() { return node_->index_within_parent; }
+    size_t index_within_parent() { return node()->index_within_parent; }
+
+    /// Get the text content of the node and its descendants
+    std::string get_text(const std::string& separator, bool strip,
+      const std::vector<std::string>& skip) const;
+
+    /// Serialize the node to HTML
+    pybind11::bytes to_html(bool pretty) const { return serialize(node(), pretty); }
   };
 
   class TagNode : public Node {
@@ -115,10 +180,11 @@ namespace gumbo_python {
     GumboVector* children_;
 
   public:
-    TagNode(GumboNode* node, GumboVector* children) : Node(node), children_(children) {}
+    TagNode(GumboNode* node, GumboVector* children, EvictionCheck check = EvictionCheck())
+      : Node(node, std::move(check)), children_(children) {}
     virtual ~TagNode() {}
 
-    virtual NodeVector children() const { return NodeVector(children_); }
+    virtual NodeVector children() const { check_(); return NodeVector(children_, check_); }
 
     virtual bool is_tag() const override { return true; }
   };
@@ -128,16 +194,16 @@ namespace gumbo_python {
     explicit Document(GumboNode* node) : TagNode(node, &node->v.document.children) {}
 
     /// Get document doctype. Returns empty string if HTML has no doctype.
-    const char* name() const { return node_->v.document.name; }
+    const char* name() const { return node()->v.document.name; }
 
-    std::string str() const override { return "<!DOCTYPE " + std::string(node_->v.document.name) + ">"; }
+    std::string str() const override { return "<!DOCTYPE " + std::string(node()->v.document.name) + ">"; }
 
     /// True if there was an explicit doctype token as opposed to it being omitted.
-    bool has_doctype() const { return node_->v.document.has_doctype; }
+    bool has_doctype() const { return node()->v.document.has_doctype; }
 
     // Fields from the doctype token, copied verbatim.
-    const char* public_identifier() const { return node_->v.document.public_identifier; }
-    const char* system_identifier() const { return node_->v.document.system_identifier; }
+    const char* public_identifier() const { return node()->v.document.public_identifier; }
+    const char* system_identifier() const { return node()->v.document.system_identifier; }
   };
 
   class Tag : public TagNode {
@@ -145,49 +211,350 @@ namespace gumbo_python {
     const char* tag_name_;
 
   public:
-    explicit Tag(GumboNode* node) : TagNode(node, &node->v.element.children) {
-      tag_name_ = gumbo_normalized_tagname(node_->v.element.tag);
+    explicit Tag(GumboNode* node, EvictionCheck check = EvictionCheck())
+      : TagNode(node, &node->v.element.children, std::move(check)) {
+      tag_name_ = gumbo_normalized_tagname(node->v.element.tag);
     }
 
-    const char* tag_name() const { return tag_name_ ; }
+    const char* tag_name() const { check_(); return tag_name_ ; }
+
+    AttributeMap attributes() const { return AttributeMap(&node()->v.element.attributes, check_); }
+
+    std::string str() const override { check_(); return "<" + std::string(tag_name_) + ">"; }
 
-    AttributeMap attributes() const { return AttributeMap(&node_->v.element.attributes); }
+    int tag_namespace() const { return node()->v.element.tag_namespace; }
 
-    std::string str() const override { return "<" + std::string(tag_name_) + ">"; }
+    /// Add an attribute or change its value
+    void set_attribute(const char* name, const char* value);
 
-    int tag_namespace() const { return node_->v.element.tag_namespace; }
+    /// Remove an attribute. Raises KeyError if the tag has no such attribute.
+    void remove_attribute(const char* name);
+
+    /// Insert a text node before the child at index, or append it if index is -1
+    void insert_text(const char* text, int index);
   };
 
   class Text : public Node {
   public:
-    explicit Text(GumboNode* node) : Node(node) {}
+    explicit Text(GumboNode* node, EvictionCheck check = EvictionCheck()) : Node(node, std::move(check)) {}
 
     std::string str() const override;
 
     /// Get clean text content without comment or cdata markers if any
-    const char* text() const { return node_->v.text.text; }
+    const char* text() const { return node()->v.text.text; }
+  };
+
+  /**
+   * HTML that nodes and tokens point into. str is encoded to UTF-8 and writable bytes-like
+   * objects are copied. Read-only buffers like mmap are used in place, so they must not change
+   * while it is alive. Must be destroyed with the GIL held.
+   */
+  class HtmlSource {
+  private:
+    /// bytes object with the HTML, unset for a read-only buffer
+    pybind11::object bytes_;
+    Py_buffer view_{};
+    bool has_view_ = false;
+    const char* data_ = nullptr;
+    size_t length_ = 0;
+
+  public:
+    explicit HtmlSource(pybind11::handle html);
+    HtmlSource(HtmlSource&& other) noexcept;
+    HtmlSource& operator=(HtmlSource&&) = delete;
+    ~HtmlSource();
+
+    const char* data() const { return data_; }
+
+    size_t length() const { return length_; }
+  };
+
+  /**
+   * Get bytes-like HTML as UTF-8 like HtmlSource. The encoding is sniffed from a byte order mark,
+   * transport_encoding and <meta> unless it is given. str HTML is encoded to UTF-8.
+   * Raises LookupError if encoding is unknown.
+   */
+  HtmlSource decode_html(pybind11::handle html, const char* encoding,
+    const char* transport_encoding);
+
+  /**
+   * Forwards element events of the tree builder to a Python object with
+   * start(tag) and/or end(tag) methods. Only elements with subscribed tags are reported.
+   * Parsing stops after the current token if a method returns True.
+   * Elements with tags from evict_tags are removed from the tree and freed after end has been
+   * called for them. Wrappers of them and of the nodes inside them raise ValueError from then on.
+   */
+  class Visitor {
+  private:
+    /// Bound visitor methods, None if the visitor lacks a method
+    pybind11::object start_;
+    pybind11::object end_;
+    TagSet tags_;
+    /// Set if evict_tags is given. Its tags are shared with the parser options.
+    std::shared_ptr<Eviction> eviction_;
+    /// An evicted element has been passed to end since the generation was last bumped
+    bool has_evicted_ = false;
+    /// Python error raised by a visitor method. Later events are ignored once it is set.
+    std::unique_ptr<pybind11::error_already_set> error_;
+    bool is_stopped_ = false;
+
+    void notify(const pybind11::object& method, GumboNode* element);
+
+    static void element_start(void* visitor, GumboNode* element);
+
+    static void element_end(void* visitor, GumboNode* element);
+
+    static bool should_stop(void* visitor, size_t offset);
+
+  public:
+    /**
+     * If tags is None, all elements with a known tag are reported. Raises ValueError unless
+     * evict_tags are a subset of tags and the visitor has an end method, so that no element
+     * is evicted before the visitor has seen it.
+     */
+    Visitor(pybind11::object visitor, pybind11::handle tags, pybind11::handle evict_tags);
+
+    /// Evicted elements are all freed once parsing is over
+    ~Visitor() { if (eviction_) ++eviction_->generation; }
+
+    /// Install the callbacks into parser options
+    void set_callbacks(GumboOptions& options);
+
+    /// Re-raise the error raised by a visitor method if any
+    void check() const;
+  };
+
+  /// GumboOptions built from the keyword arguments of parse
+  class ParseOptions {
+  private:
+    GumboOptions options_ = kGumboDefaultOptions;
+    std::array<bool, GUMBO_TAG_LAST> prune_tags_{};
+    bool has_timeout_ = false;
+    std::chrono::steady_clock::duration timeout_{};
+    std::chrono::steady_clock::time_point deadline_;
+
+    static bool is_cancelled(void* options, size_t offset);
+
+  public:
+    /**
+     * If stop_after is set, parsing stops once an element with that tag has been closed.
+     * Elements with tags from prune_tags are kept in the tree without their content.
+     * drop_whitespace and drop_comments leave whitespace-only text and comments out of the tree.
+     * Whitespace that renders, such as the space between two inline elements, is kept.
+     * The max_* limits are None or non-negative ints, see GumboOptions. Raises ValueError if one
+     * doesn't fit its GumboOptions field.
+     * timeout is None or the time limit of the parse in seconds. Raises ValueError if it is
+     * negative or NaN. Limits too long for the clock, such as inf, never expire.
+     */
+    ParseOptions(const char* stop_after, pybind11::handle prune_tags, bool drop_whitespace,
+      bool drop_comments, pybind11::handle max_tree_depth, pybind11::handle max_nodes,
+      pybind11::handle max_text_length, pybind11::handle max_attribute_length,
+      pybind11::handle max_attributes, pybind11::handle timeout);
+
+    ParseOptions(const ParseOptions&) = delete;
+    ParseOptions& operator=(const ParseOptions&) = delete;
+
+    /// Get the options for a parse that starts now. The timeout counts from this call.
+    GumboOptions& start();
   };
 
+  /// Fragment context given by names. Raises ValueError if the tag or the namespace is unknown.
+  struct FragmentContext {
+    GumboTag tag;
+    GumboNamespaceEnum tag_namespace;
+
+    FragmentContext(const char* container, const char* container_namespace);
+  };
+
+  /**
+   * Free the trees of dropped Output objects on a background thread instead of the thread
+   * that drops them. Trees are queued without a limit, so the reclaim thread may lag
+   * behind under heavy load.
+   */
+  void set_background_destroy(bool enabled);
+
+  /**
+   * Override the number of cores that parse assumes when it decides whether pipeline and
+   * chunk_size start more threads, e.g. to test those paths on a single core. 0 goes back to
+   * the number that the system reports.
+   */
+  void set_cpu_count(unsigned count);
+
   class Output {
   private:
+    /// The parsed HTML. Nodes point into its buffer, so it is kept alive with the tree.
+    HtmlSource source_;
+    const char* html_;
+    size_t length_;
     GumboOutput* output_;
+    /// Built on the first call of position
+    mutable GumboLineIndex* line_index_ = nullptr;
+    /// Nodes removed from the tree, freed with it
+    std::vector<RemovedNode> removed_;
 
   public:
-    explicit Output(const char* html) { output_ = gumbo_parse(html); }
+    /**
+     * With pipeline the tokenizer runs on a second thread, see parse_pipelined. With a non-zero
+     * chunk_size it runs on several threads in chunks, see parse_chunked.
+     */
+    explicit Output(HtmlSource source, const GumboOptions& options = kGumboDefaultOptions,
+      bool pipeline = false, size_t chunk_size = 0);
 
-    Output(const char* html, const char* fragment_ctx, const char* fragment_namespace);
+    Output(pybind11::handle html, const char* fragment_ctx, const char* fragment_namespace);
 
-    ~Output() { gumbo_destroy_output(output_); }
+    /// Take ownership of a tree parsed from source
+    Output(HtmlSource source, GumboOutput* output);
+
+    /// Frees the tree, on the reclaim thread if background destroy is enabled
+    ~Output();
 
     /// The root <html> node
     node_ptr root() const { return make_node(output_->root); }
 
     /// Document node representing the HTML document
     node_ptr document() const { return make_node(output_->document); }
+
+    /// Whether the whole input has been parsed
+    GumboOutputStatus status() const { return output_->status; }
+
+    /// Get (tag, attribute, raw_url, resolved_url, offset) tuples for links and resources
+    pybind11::list links(const char* base_url) const;
+
+    /// Get the 1-based (line, column) of a byte offset, such as Node.offset
+    pybind11::tuple position(size_t offset) const;
+
+    /**
+     * Remove a node from the tree. The node is kept until the Output is freed,
+     * so the Node objects for it and its descendants stay valid.
+     * Raises ValueError if the node is not in the tree.
+     */
+    void remove(const Node& node);
+
+    /**
+     * Serialize the whole document to HTML.
+     * With preserve=True the output is the original source, except for the parts
+     * that have been edited.
+     */
+    pybind11::bytes to_html(bool pretty, bool preserve) const;
+  };
+
+  class Rewriter {
+  private:
+    StreamRewriter rewriter_;
+
+  public:
+    void set_attribute(const std::string& selector, std::string name, std::string value);
+
+    void remove_attribute(const std::string& selector, std::string name);
+
+    /// The callback gets the attribute value and returns a new one or None to remove the attribute
+    void rewrite_attribute(const std::string& selector, std::string name, pybind11::function callback);
+
+    void remove(const std::string& selector);
+
+    void before(const std::string& selector, std::string html);
+
+    void after(const std::string& selector, std::string html);
+
+    /**
+     * Rewrite HTML and return the result as bytes.
+     * If write is given, the result is passed to it in chunks and None is returned.
+     */
+    pybind11::object rewrite(pybind11::handle html, pybind11::object write) const;
   };
 
-  std::unique_ptr<Output> parse(const char* html);
+  class TokenIterator {
+  private:
+    /// The HTML being tokenized
+    HtmlSource source_;
+    std::unique_ptr<TokenStream> stream_;
+    Token token_;
+
+  public:
+    explicit TokenIterator(pybind11::handle html);
+
+    /// For Python __iter__ method
+    TokenIterator* iter() { return this; }
+
+    /// For Python __next__ method. Returns a (type, tag, name, attributes, text, offset) tuple.
+    pybind11::tuple next();
+  };
 
-  std::unique_ptr<Output> parse_fragment(const char* html, const char* container,
+  /// Get the normalized name of a tag enum
+  const char* tag_name(int tag);
+
+  /// Get the tag enum for a tag name, GUMBO_TAG_UNKNOWN if the tag is unknown to Gumbo
+  int tag_enum(const std::string& name);
+
+  std::unique_ptr<TokenIterator> tokenize(pybind11::handle html);
+
+  /// Like html.escape. Returns text itself if nothing needs escaping.
+  pybind11::str escape(pybind11::str text, bool quote);
+
+  /// Decode character references like Gumbo does in text. Returns text itself if it has no "&".
+  pybind11::str unescape(pybind11::str text);
+
+  /**
+   * Takes the arguments of Visitor, ParseOptions and decode_html. TimeoutError is raised if parsing
+   * takes too long. Node offsets refer to the HTML decoded to UTF-8. pipeline tokenizes
+   * on a second thread, which pays off for documents of a megabyte and more. Documents longer
+   * than a non-zero chunk_size are instead split into chunks of that size for several tokenizer
+   * threads. Both are ignored on single-core machines. evict_tags needs a visitor that gets
+   * them; with drop_whitespace the whitespace between evicted elements doesn't pile up either.
+   */
+  std::unique_ptr<Output> parse(pybind11::handle html, pybind11::object visitor,
+    pybind11::handle visitor_tags, const char* stop_after, pybind11::handle prune_tags,
+    bool drop_whitespace, bool drop_comments, pybind11::handle max_tree_depth,
+    pybind11::handle max_nodes, pybind11::handle max_text_length,
+    pybind11::handle max_attribute_length, pybind11::handle max_attributes,
+    pybind11::handle timeout, const char* encoding, const char* transport_encoding,
+    bool pipeline, size_t chunk_size, pybind11::handle evict_tags);
+
+  /**
+   * Parse HTML on a native thread pool without holding the GIL. When parsing is finished,
+   * done(output, error) is called on the pool thread with either an Output or an exception.
+   * Takes the arguments of ParseOptions and decode_html, and pipeline and chunk_size like parse.
+   * HTML is decoded before it is queued.
+   */
+  void parse_in_background(pybind11::handle html, pybind11::function done, const char* stop_after,
+    pybind11::handle prune_tags, bool drop_whitespace, bool drop_comments,
+    pybind11::handle max_tree_depth, pybind11::handle max_nodes, pybind11::handle max_text_length,
+    pybind11::handle max_attribute_length, pybind11::handle max_attributes,
+    pybind11::handle timeout, const char* encoding, const char* transport_encoding,
+    bool pipeline, size_t chunk_size);
+
+  /// Finish background parses and tree destruction and stop their threads. Called at interpreter exit.
+  void shutdown_background_threads();
+
+  std::unique_ptr<Output> parse_fragment(pybind11::handle html, const char* container,
     const char* fragment_namespace);
+
+  /**
+   * Parser that keeps its buffers and state between documents, which saves allocations
+   * when many small documents or fragments are parsed one after another.
+   * Not thread-safe: use one Parser per thread.
+   */
+  class Parser {
+  private:
+    GumboParserHandle* parser_;
+
+    std::unique_ptr<Output> parse_with_context(pybind11::handle html, GumboTag tag,
+      GumboNamespaceEnum tag_namespace);
+
+  public:
+    Parser();
+
+    ~Parser() { gumbo_destroy_parser(parser_); }
+
+    Parser(const Parser&) = delete;
+    Parser& operator=(const Parser&) = delete;
+
+    std::unique_ptr<Output> parse(pybind11::handle html);
+
+    std::unique_ptr<Output> parse_fragment(pybind11::handle html, const char* container,
+      const char* fragment_namespace);
+
+    /// Free the kept state. The parser stays usable.
+    void reset() { gumbo_parser_reset(parser_); }
+  };
 }
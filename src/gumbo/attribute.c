@@ -17,15 +17,23 @@
 #include "attribute.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 
+#include "gumbo_edit.h"
 #include "util.h"
 #include "vector.h"
 
 struct GumboInternalParser;
 
+// The element editing functions get the element, but the edit flags are kept
+// on the node that contains it.
+static GumboNode* element_node(GumboElement* element) {
+  return (GumboNode*) ((char*) element - offsetof(GumboNode, v));
+}
+
 GumboAttribute* gumbo_get_attribute(
     const GumboVector* attributes, const char* name) {
   for (unsigned int i = 0; i < attributes->length; ++i) {
@@ -72,12 +80,14 @@ void gumbo_element_set_attribute(
   }
 
   gumbo_attribute_set_value(attr, value);
+  gumbo_mark_edited(element_node(element), GUMBO_INSERTION_ATTRIBUTES_EDITED);
 }
 
-void gumbo_element_remove_attribute_at(GumboElement *element, unsigned int pos) {
+void gumbo_element_remove_attribute_at(GumboElement *element, size_t pos) {
   GumboAttribute *attr = element->attributes.data[pos];
   gumbo_vector_remove_at(pos, &element->attributes);
   gumbo_destroy_attribute(attr);
+  gumbo_mark_edited(element_node(element), GUMBO_INSERTION_ATTRIBUTES_EDITED);
 }
 
 void gumbo_element_remove_attribute(GumboElement *element, GumboAttribute *attr) {
@@ -85,5 +95,6 @@ void gumbo_element_remove_attribute(GumboElement *element, GumboAttribute *attr)
   if (idx >= 0) {
     gumbo_vector_remove_at(idx, &element->attributes);
     gumbo_destroy_attribute(attr);
+    gumbo_mark_edited(element_node(element), GUMBO_INSERTION_ATTRIBUTES_EDITED);
   }
 }
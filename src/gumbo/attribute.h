@@ -30,7 +30,7 @@ void gumbo_destroy_attribute(GumboAttribute* attribute);
 
 void gumbo_element_set_attribute(
     GumboElement *element, const char *name, const char *value);
-void gumbo_element_remove_attribute_at(GumboElement *element, unsigned int pos);
+void gumbo_element_remove_attribute_at(GumboElement *element, size_t pos);
 void gumbo_element_remove_attribute(GumboElement *element, GumboAttribute *attr);
 
 #ifdef __cplusplus
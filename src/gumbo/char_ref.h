@@ -22,6 +22,7 @@
 #define GUMBO_CHAR_REF_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,6 +55,13 @@ bool consume_char_ref(
     int additional_allowed_char, bool is_in_attribute,
     OneOrTwoCodepoints* output);
 
+// Decodes the character reference at the start of text, which begins with
+// '&', the way the tokenizer does in the data state.  Parse errors are not
+// recorded.  Returns the number of bytes consumed, or 0 and kGumboNoChar in
+// output->first if the text does not start with a character reference.
+size_t decode_char_ref(
+    const char* text, size_t length, OneOrTwoCodepoints* output);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,2496 @@
+// Named character references of the HTML spec, see
+// https://html.spec.whatwg.org/multipage/named-characters.html.  Entries are
+// sorted by name in byte order, which find_named_ref relies on.  The legacy
+// references that may be used without a semicolon appear twice, with and
+// without it.
+
+// Second codepoints of the references that produce two, indexed by NamedRef.second.
+static const int kNamedRefSecondCodepoints[] = {
+  -1, 0x006a, 0x0331, 0x0333, 0x0338, 0x200a, 0x20d2, 0x20e5, 0xfe00
+};
+
+static const char kNamedRefNames[] =
+  "AEligAElig;AMPAMP;AacuteAacute;Abreve;AcircAcirc;Acy;Afr;AgraveAgrave;"
+  "Alpha;Amacr;And;Aogon;Aopf;ApplyFunction;AringAring;Ascr;Assign;Atilde"
+  "Atilde;AumlAuml;Backslash;Barv;Barwed;Bcy;Because;Bernoullis;Beta;Bfr;Bopf;"
+  "Breve;Bscr;Bumpeq;CHcy;COPYCOPY;Cacute;Cap;CapitalDifferentialD;Cayleys;"
+  "Ccaron;CcedilCcedil;Ccirc;Cconint;Cdot;Cedilla;CenterDot;Cfr;Chi;CircleDot;"
+  "CircleMinus;CirclePlus;CircleTimes;ClockwiseContourIntegral;"
+  "CloseCurlyDoubleQuote;CloseCurlyQuote;Colon;Colone;Congruent;Conint;"
+  "ContourIntegral;Copf;Coproduct;CounterClockwiseContourIntegral;Cross;Cscr;"
+  "Cup;CupCap;DD;DDotrahd;DJcy;DScy;DZcy;Dagger;Darr;Dashv;Dcaron;Dcy;Del;"
+  "Delta;Dfr;DiacriticalAcute;DiacriticalDot;DiacriticalDoubleAcute;"
+  "DiacriticalGrave;DiacriticalTilde;Diamond;DifferentialD;Dopf;Dot;DotDot;"
+  "DotEqual;DoubleContourIntegral;DoubleDot;DoubleDownArrow;DoubleLeftArrow;"
+  "DoubleLeftRightArrow;DoubleLeftTee;DoubleLongLeftArrow;"
+  "DoubleLongLeftRightArrow;DoubleLongRightArrow;DoubleRightArrow;"
+  "DoubleRightTee;DoubleUpArrow;DoubleUpDownArrow;DoubleVerticalBar;DownArrow;"
+  "DownArrowBar;DownArrowUpArrow;DownBreve;DownLeftRightVector;"
+  "DownLeftTeeVector;DownLeftVector;DownLeftVectorBar;DownRightTeeVector;"
+  "DownRightVector;DownRightVectorBar;DownTee;DownTeeArrow;Downarrow;Dscr;"
+  "Dstrok;ENG;ETHETH;EacuteEacute;Ecaron;EcircEcirc;Ecy;Edot;Efr;EgraveEgrave;"
+  "Element;Emacr;EmptySmallSquare;EmptyVerySmallSquare;Eogon;Eopf;Epsilon;"
+  "Equal;EqualTilde;Equilibrium;Escr;Esim;Eta;EumlEuml;Exists;ExponentialE;"
+  "Fcy;Ffr;FilledSmallSquare;FilledVerySmallSquare;Fopf;ForAll;Fouriertrf;"
+  "Fscr;GJcy;GTGT;Gamma;Gammad;Gbreve;Gcedil;Gcirc;Gcy;Gdot;Gfr;Gg;Gopf;"
+  "GreaterEqual;GreaterEqualLess;GreaterFullEqual;GreaterGreater;GreaterLess;"
+  "GreaterSlantEqual;GreaterTilde;Gscr;Gt;HARDcy;Hacek;Hat;Hcirc;Hfr;"
+  "HilbertSpace;Hopf;HorizontalLine;Hscr;Hstrok;HumpDownHump;HumpEqual;IEcy;"
+  "IJlig;IOcy;IacuteIacute;IcircIcirc;Icy;Idot;Ifr;IgraveIgrave;Im;Imacr;"
+  "ImaginaryI;Implies;Int;Integral;Intersection;InvisibleComma;InvisibleTimes;"
+  "Iogon;Iopf;Iota;Iscr;Itilde;Iukcy;IumlIuml;Jcirc;Jcy;Jfr;Jopf;Jscr;Jsercy;"
+  "Jukcy;KHcy;KJcy;Kappa;Kcedil;Kcy;Kfr;Kopf;Kscr;LJcy;LTLT;Lacute;Lambda;"
+  "Lang;Laplacetrf;Larr;Lcaron;Lcedil;Lcy;LeftAngleBracket;LeftArrow;"
+  "LeftArrowBar;LeftArrowRightArrow;LeftCeiling;LeftDoubleBracket;"
+  "LeftDownTeeVector;LeftDownVector;LeftDownVectorBar;LeftFloor;"
+  "LeftRightArrow;LeftRightVector;LeftTee;LeftTeeArrow;LeftTeeVector;"
+  "LeftTriangle;LeftTriangleBar;LeftTriangleEqual;LeftUpDownVector;"
+  "LeftUpTeeVector;LeftUpVector;LeftUpVectorBar;LeftVector;LeftVectorBar;"
+  "Leftarrow;Leftrightarrow;LessEqualGreater;LessFullEqual;LessGreater;"
+  "LessLess;LessSlantEqual;LessTilde;Lfr;Ll;Lleftarrow;Lmidot;LongLeftArrow;"
+  "LongLeftRightArrow;LongRightArrow;Longleftarrow;Longleftrightarrow;"
+  "Longrightarrow;Lopf;LowerLeftArrow;LowerRightArrow;Lscr;Lsh;Lstrok;Lt;Map;"
+  "Mcy;MediumSpace;Mellintrf;Mfr;MinusPlus;Mopf;Mscr;Mu;NJcy;Nacute;Ncaron;"
+  "Ncedil;Ncy;NegativeMediumSpace;NegativeThickSpace;NegativeThinSpace;"
+  "NegativeVeryThinSpace;NestedGreaterGreater;NestedLessLess;NewLine;Nfr;"
+  "NoBreak;NonBreakingSpace;Nopf;Not;NotCongruent;NotCupCap;"
+  "NotDoubleVerticalBar;NotElement;NotEqual;NotEqualTilde;NotExists;"
+  "NotGreater;NotGreaterEqual;NotGreaterFullEqual;NotGreaterGreater;"
+  "NotGreaterLess;NotGreaterSlantEqual;NotGreaterTilde;NotHumpDownHump;"
+  "NotHumpEqual;NotLeftTriangle;NotLeftTriangleBar;NotLeftTriangleEqual;"
+  "NotLess;NotLessEqual;NotLessGreater;NotLessLess;NotLessSlantEqual;"
+  "NotLessTilde;NotNestedGreaterGreater;NotNestedLessLess;NotPrecedes;"
+  "NotPrecedesEqual;NotPrecedesSlantEqual;NotReverseElement;NotRightTriangle;"
+  "NotRightTriangleBar;NotRightTriangleEqual;NotSquareSubset;"
+  "NotSquareSubsetEqual;NotSquareSuperset;NotSquareSupersetEqual;NotSubset;"
+  "NotSubsetEqual;NotSucceeds;NotSucceedsEqual;NotSucceedsSlantEqual;"
+  "NotSucceedsTilde;NotSuperset;NotSupersetEqual;NotTilde;NotTildeEqual;"
+  "NotTildeFullEqual;NotTildeTilde;NotVerticalBar;Nscr;NtildeNtilde;Nu;OElig;"
+  "OacuteOacute;OcircOcirc;Ocy;Odblac;Ofr;OgraveOgrave;Omacr;Omega;Omicron;"
+  "Oopf;OpenCurlyDoubleQuote;OpenCurlyQuote;Or;Oscr;OslashOslash;OtildeOtilde;"
+  "Otimes;OumlOuml;OverBar;OverBrace;OverBracket;OverParenthesis;PartialD;Pcy;"
+  "Pfr;Phi;Pi;PlusMinus;Poincareplane;Popf;Pr;Precedes;PrecedesEqual;"
+  "PrecedesSlantEqual;PrecedesTilde;Prime;Product;Proportion;Proportional;"
+  "Pscr;Psi;QUOTQUOT;Qfr;Qopf;Qscr;RBarr;REGREG;Racute;Rang;Rarr;Rarrtl;"
+  "Rcaron;Rcedil;Rcy;Re;ReverseElement;ReverseEquilibrium;"
+  "ReverseUpEquilibrium;Rfr;Rho;RightAngleBracket;RightArrow;RightArrowBar;"
+  "RightArrowLeftArrow;RightCeiling;RightDoubleBracket;RightDownTeeVector;"
+  "RightDownVector;RightDownVectorBar;RightFloor;RightTee;RightTeeArrow;"
+  "RightTeeVector;RightTriangle;RightTriangleBar;RightTriangleEqual;"
+  "RightUpDownVector;RightUpTeeVector;RightUpVector;RightUpVectorBar;"
+  "RightVector;RightVectorBar;Rightarrow;Ropf;RoundImplies;Rrightarrow;Rscr;"
+  "Rsh;RuleDelayed;SHCHcy;SHcy;SOFTcy;Sacute;Sc;Scaron;Scedil;Scirc;Scy;Sfr;"
+  "ShortDownArrow;ShortLeftArrow;ShortRightArrow;ShortUpArrow;Sigma;"
+  "SmallCircle;Sopf;Sqrt;Square;SquareIntersection;SquareSubset;"
+  "SquareSubsetEqual;SquareSuperset;SquareSupersetEqual;SquareUnion;Sscr;Star;"
+  "Sub;Subset;SubsetEqual;Succeeds;SucceedsEqual;SucceedsSlantEqual;"
+  "SucceedsTilde;SuchThat;Sum;Sup;Superset;SupersetEqual;Supset;THORNTHORN;"
+  "TRADE;TSHcy;TScy;Tab;Tau;Tcaron;Tcedil;Tcy;Tfr;Therefore;Theta;ThickSpace;"
+  "ThinSpace;Tilde;TildeEqual;TildeFullEqual;TildeTilde;Topf;TripleDot;Tscr;"
+  "Tstrok;UacuteUacute;Uarr;Uarrocir;Ubrcy;Ubreve;UcircUcirc;Ucy;Udblac;Ufr;"
+  "UgraveUgrave;Umacr;UnderBar;UnderBrace;UnderBracket;UnderParenthesis;Union;"
+  "UnionPlus;Uogon;Uopf;UpArrow;UpArrowBar;UpArrowDownArrow;UpDownArrow;"
+  "UpEquilibrium;UpTee;UpTeeArrow;Uparrow;Updownarrow;UpperLeftArrow;"
+  "UpperRightArrow;Upsi;Upsilon;Uring;Uscr;Utilde;UumlUuml;VDash;Vbar;Vcy;"
+  "Vdash;Vdashl;Vee;Verbar;Vert;VerticalBar;VerticalLine;VerticalSeparator;"
+  "VerticalTilde;VeryThinSpace;Vfr;Vopf;Vscr;Vvdash;Wcirc;Wedge;Wfr;Wopf;Wscr;"
+  "Xfr;Xi;Xopf;Xscr;YAcy;YIcy;YUcy;YacuteYacute;Ycirc;Ycy;Yfr;Yopf;Yscr;Yuml;"
+  "ZHcy;Zacute;Zcaron;Zcy;Zdot;ZeroWidthSpace;Zeta;Zfr;Zopf;Zscr;aacuteaacute;"
+  "abreve;ac;acE;acd;acircacirc;acuteacute;acy;aeligaelig;af;afr;agraveagrave;"
+  "alefsym;aleph;alpha;amacr;amalg;ampamp;and;andand;andd;andslope;andv;ang;"
+  "ange;angle;angmsd;angmsdaa;angmsdab;angmsdac;angmsdad;angmsdae;angmsdaf;"
+  "angmsdag;angmsdah;angrt;angrtvb;angrtvbd;angsph;angst;angzarr;aogon;aopf;"
+  "ap;apE;apacir;ape;apid;apos;approx;approxeq;aringaring;ascr;ast;asymp;"
+  "asympeq;atildeatilde;aumlauml;awconint;awint;bNot;backcong;backepsilon;"
+  "backprime;backsim;backsimeq;barvee;barwed;barwedge;bbrk;bbrktbrk;bcong;bcy;"
+  "bdquo;becaus;because;bemptyv;bepsi;bernou;beta;beth;between;bfr;bigcap;"
+  "bigcirc;bigcup;bigodot;bigoplus;bigotimes;bigsqcup;bigstar;bigtriangledown;"
+  "bigtriangleup;biguplus;bigvee;bigwedge;bkarow;blacklozenge;blacksquare;"
+  "blacktriangle;blacktriangledown;blacktriangleleft;blacktriangleright;blank;"
+  "blk12;blk14;blk34;block;bne;bnequiv;bnot;bopf;bot;bottom;bowtie;boxDL;"
+  "boxDR;boxDl;boxDr;boxH;boxHD;boxHU;boxHd;boxHu;boxUL;boxUR;boxUl;boxUr;"
+  "boxV;boxVH;boxVL;boxVR;boxVh;boxVl;boxVr;boxbox;boxdL;boxdR;boxdl;boxdr;"
+  "boxh;boxhD;boxhU;boxhd;boxhu;boxminus;boxplus;boxtimes;boxuL;boxuR;boxul;"
+  "boxur;boxv;boxvH;boxvL;boxvR;boxvh;boxvl;boxvr;bprime;breve;brvbarbrvbar;"
+  "bscr;bsemi;bsim;bsime;bsol;bsolb;bsolhsub;bull;bullet;bump;bumpE;bumpe;"
+  "bumpeq;cacute;cap;capand;capbrcup;capcap;capcup;capdot;caps;caret;caron;"
+  "ccaps;ccaron;ccedilccedil;ccirc;ccups;ccupssm;cdot;cedilcedil;cemptyv;cent"
+  "cent;centerdot;cfr;chcy;check;checkmark;chi;cir;cirE;circ;circeq;"
+  "circlearrowleft;circlearrowright;circledR;circledS;circledast;circledcirc;"
+  "circleddash;cire;cirfnint;cirmid;cirscir;clubs;clubsuit;colon;colone;"
+  "coloneq;comma;commat;comp;compfn;complement;complexes;cong;congdot;conint;"
+  "copf;coprod;copycopy;copysr;crarr;cross;cscr;csub;csube;csup;csupe;ctdot;"
+  "cudarrl;cudarrr;cuepr;cuesc;cularr;cularrp;cup;cupbrcap;cupcap;cupcup;"
+  "cupdot;cupor;cups;curarr;curarrm;curlyeqprec;curlyeqsucc;curlyvee;"
+  "curlywedge;currencurren;curvearrowleft;curvearrowright;cuvee;cuwed;"
+  "cwconint;cwint;cylcty;dArr;dHar;dagger;daleth;darr;dash;dashv;dbkarow;"
+  "dblac;dcaron;dcy;dd;ddagger;ddarr;ddotseq;degdeg;delta;demptyv;dfisht;dfr;"
+  "dharl;dharr;diam;diamond;diamondsuit;diams;die;digamma;disin;div;divide"
+  "divide;divideontimes;divonx;djcy;dlcorn;dlcrop;dollar;dopf;dot;doteq;"
+  "doteqdot;dotminus;dotplus;dotsquare;doublebarwedge;downarrow;"
+  "downdownarrows;downharpoonleft;downharpoonright;drbkarow;drcorn;drcrop;"
+  "dscr;dscy;dsol;dstrok;dtdot;dtri;dtrif;duarr;duhar;dwangle;dzcy;dzigrarr;"
+  "eDDot;eDot;eacuteeacute;easter;ecaron;ecir;ecircecirc;ecolon;ecy;edot;ee;"
+  "efDot;efr;eg;egraveegrave;egs;egsdot;el;elinters;ell;els;elsdot;emacr;"
+  "empty;emptyset;emptyv;emsp13;emsp14;emsp;eng;ensp;eogon;eopf;epar;eparsl;"
+  "eplus;epsi;epsilon;epsiv;eqcirc;eqcolon;eqsim;eqslantgtr;eqslantless;"
+  "equals;equest;equiv;equivDD;eqvparsl;erDot;erarr;escr;esdot;esim;eta;eth"
+  "eth;eumleuml;euro;excl;exist;expectation;exponentiale;fallingdotseq;fcy;"
+  "female;ffilig;fflig;ffllig;ffr;filig;fjlig;flat;fllig;fltns;fnof;fopf;"
+  "forall;fork;forkv;fpartint;frac12frac12;frac13;frac14frac14;frac15;frac16;"
+  "frac18;frac23;frac25;frac34frac34;frac35;frac38;frac45;frac56;frac58;"
+  "frac78;frasl;frown;fscr;gE;gEl;gacute;gamma;gammad;gap;gbreve;gcirc;gcy;"
+  "gdot;ge;gel;geq;geqq;geqslant;ges;gescc;gesdot;gesdoto;gesdotol;gesl;"
+  "gesles;gfr;gg;ggg;gimel;gjcy;gl;glE;gla;glj;gnE;gnap;gnapprox;gne;gneq;"
+  "gneqq;gnsim;gopf;grave;gscr;gsim;gsime;gsiml;gtgt;gtcc;gtcir;gtdot;gtlPar;"
+  "gtquest;gtrapprox;gtrarr;gtrdot;gtreqless;gtreqqless;gtrless;gtrsim;"
+  "gvertneqq;gvnE;hArr;hairsp;half;hamilt;hardcy;harr;harrcir;harrw;hbar;"
+  "hcirc;hearts;heartsuit;hellip;hercon;hfr;hksearow;hkswarow;hoarr;homtht;"
+  "hookleftarrow;hookrightarrow;hopf;horbar;hscr;hslash;hstrok;hybull;hyphen;"
+  "iacuteiacute;ic;icircicirc;icy;iecy;iexcliexcl;iff;ifr;igraveigrave;ii;"
+  "iiiint;iiint;iinfin;iiota;ijlig;imacr;image;imagline;imagpart;imath;imof;"
+  "imped;in;incare;infin;infintie;inodot;int;intcal;integers;intercal;"
+  "intlarhk;intprod;iocy;iogon;iopf;iota;iprod;iquestiquest;iscr;isin;isinE;"
+  "isindot;isins;isinsv;isinv;it;itilde;iukcy;iumliuml;jcirc;jcy;jfr;jmath;"
+  "jopf;jscr;jsercy;jukcy;kappa;kappav;kcedil;kcy;kfr;kgreen;khcy;kjcy;kopf;"
+  "kscr;lAarr;lArr;lAtail;lBarr;lE;lEg;lHar;lacute;laemptyv;lagran;lambda;"
+  "lang;langd;langle;lap;laquolaquo;larr;larrb;larrbfs;larrfs;larrhk;larrlp;"
+  "larrpl;larrsim;larrtl;lat;latail;late;lates;lbarr;lbbrk;lbrace;lbrack;"
+  "lbrke;lbrksld;lbrkslu;lcaron;lcedil;lceil;lcub;lcy;ldca;ldquo;ldquor;"
+  "ldrdhar;ldrushar;ldsh;le;leftarrow;leftarrowtail;leftharpoondown;"
+  "leftharpoonup;leftleftarrows;leftrightarrow;leftrightarrows;"
+  "leftrightharpoons;leftrightsquigarrow;leftthreetimes;leg;leq;leqq;leqslant;"
+  "les;lescc;lesdot;lesdoto;lesdotor;lesg;lesges;lessapprox;lessdot;lesseqgtr;"
+  "lesseqqgtr;lessgtr;lesssim;lfisht;lfloor;lfr;lg;lgE;lhard;lharu;lharul;"
+  "lhblk;ljcy;ll;llarr;llcorner;llhard;lltri;lmidot;lmoust;lmoustache;lnE;"
+  "lnap;lnapprox;lne;lneq;lneqq;lnsim;loang;loarr;lobrk;longleftarrow;"
+  "longleftrightarrow;longmapsto;longrightarrow;looparrowleft;looparrowright;"
+  "lopar;lopf;loplus;lotimes;lowast;lowbar;loz;lozenge;lozf;lpar;lparlt;lrarr;"
+  "lrcorner;lrhar;lrhard;lrm;lrtri;lsaquo;lscr;lsh;lsim;lsime;lsimg;lsqb;"
+  "lsquo;lsquor;lstrok;ltlt;ltcc;ltcir;ltdot;lthree;ltimes;ltlarr;ltquest;"
+  "ltrPar;ltri;ltrie;ltrif;lurdshar;luruhar;lvertneqq;lvnE;mDDot;macrmacr;"
+  "male;malt;maltese;map;mapsto;mapstodown;mapstoleft;mapstoup;marker;mcomma;"
+  "mcy;mdash;measuredangle;mfr;mho;micromicro;mid;midast;midcir;middotmiddot;"
+  "minus;minusb;minusd;minusdu;mlcp;mldr;mnplus;models;mopf;mp;mscr;mstpos;mu;"
+  "multimap;mumap;nGg;nGt;nGtv;nLeftarrow;nLeftrightarrow;nLl;nLt;nLtv;"
+  "nRightarrow;nVDash;nVdash;nabla;nacute;nang;nap;napE;napid;napos;napprox;"
+  "natur;natural;naturals;nbspnbsp;nbump;nbumpe;ncap;ncaron;ncedil;ncong;"
+  "ncongdot;ncup;ncy;ndash;ne;neArr;nearhk;nearr;nearrow;nedot;nequiv;nesear;"
+  "nesim;nexist;nexists;nfr;ngE;nge;ngeq;ngeqq;ngeqslant;nges;ngsim;ngt;ngtr;"
+  "nhArr;nharr;nhpar;ni;nis;nisd;niv;njcy;nlArr;nlE;nlarr;nldr;nle;nleftarrow;"
+  "nleftrightarrow;nleq;nleqq;nleqslant;nles;nless;nlsim;nlt;nltri;nltrie;"
+  "nmid;nopf;notnot;notin;notinE;notindot;notinva;notinvb;notinvc;notni;"
+  "notniva;notnivb;notnivc;npar;nparallel;nparsl;npart;npolint;npr;nprcue;"
+  "npre;nprec;npreceq;nrArr;nrarr;nrarrc;nrarrw;nrightarrow;nrtri;nrtrie;nsc;"
+  "nsccue;nsce;nscr;nshortmid;nshortparallel;nsim;nsime;nsimeq;nsmid;nspar;"
+  "nsqsube;nsqsupe;nsub;nsubE;nsube;nsubset;nsubseteq;nsubseteqq;nsucc;"
+  "nsucceq;nsup;nsupE;nsupe;nsupset;nsupseteq;nsupseteqq;ntgl;ntildentilde;"
+  "ntlg;ntriangleleft;ntrianglelefteq;ntriangleright;ntrianglerighteq;nu;num;"
+  "numero;numsp;nvDash;nvHarr;nvap;nvdash;nvge;nvgt;nvinfin;nvlArr;nvle;nvlt;"
+  "nvltrie;nvrArr;nvrtrie;nvsim;nwArr;nwarhk;nwarr;nwarrow;nwnear;oS;oacute"
+  "oacute;oast;ocir;ocircocirc;ocy;odash;odblac;odiv;odot;odsold;oelig;ofcir;"
+  "ofr;ogon;ograveograve;ogt;ohbar;ohm;oint;olarr;olcir;olcross;oline;olt;"
+  "omacr;omega;omicron;omid;ominus;oopf;opar;operp;oplus;or;orarr;ord;order;"
+  "orderof;ordfordf;ordmordm;origof;oror;orslope;orv;oscr;oslashoslash;osol;"
+  "otildeotilde;otimes;otimesas;oumlouml;ovbar;par;parapara;parallel;parsim;"
+  "parsl;part;pcy;percnt;period;permil;perp;pertenk;pfr;phi;phiv;phmmat;phone;"
+  "pi;pitchfork;piv;planck;planckh;plankv;plus;plusacir;plusb;pluscir;plusdo;"
+  "plusdu;pluse;plusmnplusmn;plussim;plustwo;pm;pointint;popf;poundpound;pr;"
+  "prE;prap;prcue;pre;prec;precapprox;preccurlyeq;preceq;precnapprox;precneqq;"
+  "precnsim;precsim;prime;primes;prnE;prnap;prnsim;prod;profalar;profline;"
+  "profsurf;prop;propto;prsim;prurel;pscr;psi;puncsp;qfr;qint;qopf;qprime;"
+  "qscr;quaternions;quatint;quest;questeq;quotquot;rAarr;rArr;rAtail;rBarr;"
+  "rHar;race;racute;radic;raemptyv;rang;rangd;range;rangle;raquoraquo;rarr;"
+  "rarrap;rarrb;rarrbfs;rarrc;rarrfs;rarrhk;rarrlp;rarrpl;rarrsim;rarrtl;"
+  "rarrw;ratail;ratio;rationals;rbarr;rbbrk;rbrace;rbrack;rbrke;rbrksld;"
+  "rbrkslu;rcaron;rcedil;rceil;rcub;rcy;rdca;rdldhar;rdquo;rdquor;rdsh;real;"
+  "realine;realpart;reals;rect;regreg;rfisht;rfloor;rfr;rhard;rharu;rharul;"
+  "rho;rhov;rightarrow;rightarrowtail;rightharpoondown;rightharpoonup;"
+  "rightleftarrows;rightleftharpoons;rightrightarrows;rightsquigarrow;"
+  "rightthreetimes;ring;risingdotseq;rlarr;rlhar;rlm;rmoust;rmoustache;rnmid;"
+  "roang;roarr;robrk;ropar;ropf;roplus;rotimes;rpar;rpargt;rppolint;rrarr;"
+  "rsaquo;rscr;rsh;rsqb;rsquo;rsquor;rthree;rtimes;rtri;rtrie;rtrif;rtriltri;"
+  "ruluhar;rx;sacute;sbquo;sc;scE;scap;scaron;sccue;sce;scedil;scirc;scnE;"
+  "scnap;scnsim;scpolint;scsim;scy;sdot;sdotb;sdote;seArr;searhk;searr;"
+  "searrow;sectsect;semi;seswar;setminus;setmn;sext;sfr;sfrown;sharp;shchcy;"
+  "shcy;shortmid;shortparallel;shyshy;sigma;sigmaf;sigmav;sim;simdot;sime;"
+  "simeq;simg;simgE;siml;simlE;simne;simplus;simrarr;slarr;smallsetminus;"
+  "smashp;smeparsl;smid;smile;smt;smte;smtes;softcy;sol;solb;solbar;sopf;"
+  "spades;spadesuit;spar;sqcap;sqcaps;sqcup;sqcups;sqsub;sqsube;sqsubset;"
+  "sqsubseteq;sqsup;sqsupe;sqsupset;sqsupseteq;squ;square;squarf;squf;srarr;"
+  "sscr;ssetmn;ssmile;sstarf;star;starf;straightepsilon;straightphi;strns;sub;"
+  "subE;subdot;sube;subedot;submult;subnE;subne;subplus;subrarr;subset;"
+  "subseteq;subseteqq;subsetneq;subsetneqq;subsim;subsub;subsup;succ;"
+  "succapprox;succcurlyeq;succeq;succnapprox;succneqq;succnsim;succsim;sum;"
+  "sung;sup1sup1;sup2sup2;sup3sup3;sup;supE;supdot;supdsub;supe;supedot;"
+  "suphsol;suphsub;suplarr;supmult;supnE;supne;supplus;supset;supseteq;"
+  "supseteqq;supsetneq;supsetneqq;supsim;supsub;supsup;swArr;swarhk;swarr;"
+  "swarrow;swnwar;szligszlig;target;tau;tbrk;tcaron;tcedil;tcy;tdot;telrec;"
+  "tfr;there4;therefore;theta;thetasym;thetav;thickapprox;thicksim;thinsp;"
+  "thkap;thksim;thornthorn;tilde;timestimes;timesb;timesbar;timesd;tint;toea;"
+  "top;topbot;topcir;topf;topfork;tosa;tprime;trade;triangle;triangledown;"
+  "triangleleft;trianglelefteq;triangleq;triangleright;trianglerighteq;tridot;"
+  "trie;triminus;triplus;trisb;tritime;trpezium;tscr;tscy;tshcy;tstrok;twixt;"
+  "twoheadleftarrow;twoheadrightarrow;uArr;uHar;uacuteuacute;uarr;ubrcy;"
+  "ubreve;ucircucirc;ucy;udarr;udblac;udhar;ufisht;ufr;ugraveugrave;uharl;"
+  "uharr;uhblk;ulcorn;ulcorner;ulcrop;ultri;umacr;umluml;uogon;uopf;uparrow;"
+  "updownarrow;upharpoonleft;upharpoonright;uplus;upsi;upsih;upsilon;"
+  "upuparrows;urcorn;urcorner;urcrop;uring;urtri;uscr;utdot;utilde;utri;utrif;"
+  "uuarr;uumluuml;uwangle;vArr;vBar;vBarv;vDash;vangrt;varepsilon;varkappa;"
+  "varnothing;varphi;varpi;varpropto;varr;varrho;varsigma;varsubsetneq;"
+  "varsubsetneqq;varsupsetneq;varsupsetneqq;vartheta;vartriangleleft;"
+  "vartriangleright;vcy;vdash;vee;veebar;veeeq;vellip;verbar;vert;vfr;vltri;"
+  "vnsub;vnsup;vopf;vprop;vrtri;vscr;vsubnE;vsubne;vsupnE;vsupne;vzigzag;"
+  "wcirc;wedbar;wedge;wedgeq;weierp;wfr;wopf;wp;wr;wreath;wscr;xcap;xcirc;"
+  "xcup;xdtri;xfr;xhArr;xharr;xi;xlArr;xlarr;xmap;xnis;xodot;xopf;xoplus;"
+  "xotime;xrArr;xrarr;xscr;xsqcup;xuplus;xutri;xvee;xwedge;yacuteyacute;yacy;"
+  "ycirc;ycy;yenyen;yfr;yicy;yopf;yscr;yucy;yumlyuml;zacute;zcaron;zcy;zdot;"
+  "zeetrf;zeta;zfr;zhcy;zigrarr;zopf;zscr;zwj;zwnj;";
+
+static const NamedRef kNamedRefs[] = {
+  { 0, 5, 0, 0x00c6 },  // AElig
+  { 5, 6, 0, 0x00c6 },  // AElig;
+  { 11, 3, 0, 0x0026 },  // AMP
+  { 14, 4, 0, 0x0026 },  // AMP;
+  { 18, 6, 0, 0x00c1 },  // Aacute
+  { 24, 7, 0, 0x00c1 },  // Aacute;
+  { 31, 7, 0, 0x0102 },  // Abreve;
+  { 38, 5, 0, 0x00c2 },  // Acirc
+  { 43, 6, 0, 0x00c2 },  // Acirc;
+  { 49, 4, 0, 0x0410 },  // Acy;
+  { 53, 4, 0, 0x1d504 },  // Afr;
+  { 57, 6, 0, 0x00c0 },  // Agrave
+  { 63, 7, 0, 0x00c0 },  // Agrave;
+  { 70, 6, 0, 0x0391 },  // Alpha;
+  { 76, 6, 0, 0x0100 },  // Amacr;
+  { 82, 4, 0, 0x2a53 },  // And;
+  { 86, 6, 0, 0x0104 },  // Aogon;
+  { 92, 5, 0, 0x1d538 },  // Aopf;
+  { 97, 14, 0, 0x2061 },  // ApplyFunction;
+  { 111, 5, 0, 0x00c5 },  // Aring
+  { 116, 6, 0, 0x00c5 },  // Aring;
+  { 122, 5, 0, 0x1d49c },  // Ascr;
+  { 127, 7, 0, 0x2254 },  // Assign;
+  { 134, 6, 0, 0x00c3 },  // Atilde
+  { 140, 7, 0, 0x00c3 },  // Atilde;
+  { 147, 4, 0, 0x00c4 },  // Auml
+  { 151, 5, 0, 0x00c4 },  // Auml;
+  { 156, 10, 0, 0x2216 },  // Backslash;
+  { 166, 5, 0, 0x2ae7 },  // Barv;
+  { 171, 7, 0, 0x2306 },  // Barwed;
+  { 178, 4, 0, 0x0411 },  // Bcy;
+  { 182, 8, 0, 0x2235 },  // Because;
+  { 190, 11, 0, 0x212c },  // Bernoullis;
+  { 201, 5, 0, 0x0392 },  // Beta;
+  { 206, 4, 0, 0x1d505 },  // Bfr;
+  { 210, 5, 0, 0x1d539 },  // Bopf;
+  { 215, 6, 0, 0x02d8 },  // Breve;
+  { 221, 5, 0, 0x212c },  // Bscr;
+  { 226, 7, 0, 0x224e },  // Bumpeq;
+  { 233, 5, 0, 0x0427 },  // CHcy;
+  { 238, 4, 0, 0x00a9 },  // COPY
+  { 242, 5, 0, 0x00a9 },  // COPY;
+  { 247, 7, 0, 0x0106 },  // Cacute;
+  { 254, 4, 0, 0x22d2 },  // Cap;
+  { 258, 21, 0, 0x2145 },  // CapitalDifferentialD;
+  { 279, 8, 0, 0x212d },  // Cayleys;
+  { 287, 7, 0, 0x010c },  // Ccaron;
+  { 294, 6, 0, 0x00c7 },  // Ccedil
+  { 300, 7, 0, 0x00c7 },  // Ccedil;
+  { 307, 6, 0, 0x0108 },  // Ccirc;
+  { 313, 8, 0, 0x2230 },  // Cconint;
+  { 321, 5, 0, 0x010a },  // Cdot;
+  { 326, 8, 0, 0x00b8 },  // Cedilla;
+  { 334, 10, 0, 0x00b7 },  // CenterDot;
+  { 344, 4, 0, 0x212d },  // Cfr;
+  { 348, 4, 0, 0x03a7 },  // Chi;
+  { 352, 10, 0, 0x2299 },  // CircleDot;
+  { 362, 12, 0, 0x2296 },  // CircleMinus;
+  { 374, 11, 0, 0x2295 },  // CirclePlus;
+  { 385, 12, 0, 0x2297 },  // CircleTimes;
+  { 397, 25, 0, 0x2232 },  // ClockwiseContourIntegral;
+  { 422, 22, 0, 0x201d },  // CloseCurlyDoubleQuote;
+  { 444, 16, 0, 0x2019 },  // CloseCurlyQuote;
+  { 460, 6, 0, 0x2237 },  // Colon;
+  { 466, 7, 0, 0x2a74 },  // Colone;
+  { 473, 10, 0, 0x2261 },  // Congruent;
+  { 483, 7, 0, 0x222f },  // Conint;
+  { 490, 16, 0, 0x222e },  // ContourIntegral;
+  { 506, 5, 0, 0x2102 },  // Copf;
+  { 511, 10, 0, 0x2210 },  // Coproduct;
+  { 521, 32, 0, 0x2233 },  // CounterClockwiseContourIntegral;
+  { 553, 6, 0, 0x2a2f },  // Cross;
+  { 559, 5, 0, 0x1d49e },  // Cscr;
+  { 564, 4, 0, 0x22d3 },  // Cup;
+  { 568, 7, 0, 0x224d },  // CupCap;
+  { 575, 3, 0, 0x2145 },  // DD;
+  { 578, 9, 0, 0x2911 },  // DDotrahd;
+  { 587, 5, 0, 0x0402 },  // DJcy;
+  { 592, 5, 0, 0x0405 },  // DScy;
+  { 597, 5, 0, 0x040f },  // DZcy;
+  { 602, 7, 0, 0x2021 },  // Dagger;
+  { 609, 5, 0, 0x21a1 },  // Darr;
+  { 614, 6, 0, 0x2ae4 },  // Dashv;
+  { 620, 7, 0, 0x010e },  // Dcaron;
+  { 627, 4, 0, 0x0414 },  // Dcy;
+  { 631, 4, 0, 0x2207 },  // Del;
+  { 635, 6, 0, 0x0394 },  // Delta;
+  { 641, 4, 0, 0x1d507 },  // Dfr;
+  { 645, 17, 0, 0x00b4 },  // DiacriticalAcute;
+  { 662, 15, 0, 0x02d9 },  // DiacriticalDot;
+  { 677, 23, 0, 0x02dd },  // DiacriticalDoubleAcute;
+  { 700, 17, 0, 0x0060 },  // DiacriticalGrave;
+  { 717, 17, 0, 0x02dc },  // DiacriticalTilde;
+  { 734, 8, 0, 0x22c4 },  // Diamond;
+  { 742, 14, 0, 0x2146 },  // DifferentialD;
+  { 756, 5, 0, 0x1d53b },  // Dopf;
+  { 761, 4, 0, 0x00a8 },  // Dot;
+  { 765, 7, 0, 0x20dc },  // DotDot;
+  { 772, 9, 0, 0x2250 },  // DotEqual;
+  { 781, 22, 0, 0x222f },  // DoubleContourIntegral;
+  { 803, 10, 0, 0x00a8 },  // DoubleDot;
+  { 813, 16, 0, 0x21d3 },  // DoubleDownArrow;
+  { 829, 16, 0, 0x21d0 },  // DoubleLeftArrow;
+  { 845, 21, 0, 0x21d4 },  // DoubleLeftRightArrow;
+  { 866, 14, 0, 0x2ae4 },  // DoubleLeftTee;
+  { 880, 20, 0, 0x27f8 },  // DoubleLongLeftArrow;
+  { 900, 25, 0, 0x27fa },  // DoubleLongLeftRightArrow;
+  { 925, 21, 0, 0x27f9 },  // DoubleLongRightArrow;
+  { 946, 17, 0, 0x21d2 },  // DoubleRightArrow;
+  { 963, 15, 0, 0x22a8 },  // DoubleRightTee;
+  { 978, 14, 0, 0x21d1 },  // DoubleUpArrow;
+  { 992, 18, 0, 0x21d5 },  // DoubleUpDownArrow;
+  { 1010, 18, 0, 0x2225 },  // DoubleVerticalBar;
+  { 1028, 10, 0, 0x2193 },  // DownArrow;
+  { 1038, 13, 0, 0x2913 },  // DownArrowBar;
+  { 1051, 17, 0, 0x21f5 },  // DownArrowUpArrow;
+  { 1068, 10, 0, 0x0311 },  // DownBreve;
+  { 1078, 20, 0, 0x2950 },  // DownLeftRightVector;
+  { 1098, 18, 0, 0x295e },  // DownLeftTeeVector;
+  { 1116, 15, 0, 0x21bd },  // DownLeftVector;
+  { 1131, 18, 0, 0x2956 },  // DownLeftVectorBar;
+  { 1149, 19, 0, 0x295f },  // DownRightTeeVector;
+  { 1168, 16, 0, 0x21c1 },  // DownRightVector;
+  { 1184, 19, 0, 0x2957 },  // DownRightVectorBar;
+  { 1203, 8, 0, 0x22a4 },  // DownTee;
+  { 1211, 13, 0, 0x21a7 },  // DownTeeArrow;
+  { 1224, 10, 0, 0x21d3 },  // Downarrow;
+  { 1234, 5, 0, 0x1d49f },  // Dscr;
+  { 1239, 7, 0, 0x0110 },  // Dstrok;
+  { 1246, 4, 0, 0x014a },  // ENG;
+  { 1250, 3, 0, 0x00d0 },  // ETH
+  { 1253, 4, 0, 0x00d0 },  // ETH;
+  { 1257, 6, 0, 0x00c9 },  // Eacute
+  { 1263, 7, 0, 0x00c9 },  // Eacute;
+  { 1270, 7, 0, 0x011a },  // Ecaron;
+  { 1277, 5, 0, 0x00ca },  // Ecirc
+  { 1282, 6, 0, 0x00ca },  // Ecirc;
+  { 1288, 4, 0, 0x042d },  // Ecy;
+  { 1292, 5, 0, 0x0116 },  // Edot;
+  { 1297, 4, 0, 0x1d508 },  // Efr;
+  { 1301, 6, 0, 0x00c8 },  // Egrave
+  { 1307, 7, 0, 0x00c8 },  // Egrave;
+  { 1314, 8, 0, 0x2208 },  // Element;
+  { 1322, 6, 0, 0x0112 },  // Emacr;
+  { 1328, 17, 0, 0x25fb },  // EmptySmallSquare;
+  { 1345, 21, 0, 0x25ab },  // EmptyVerySmallSquare;
+  { 1366, 6, 0, 0x0118 },  // Eogon;
+  { 1372, 5, 0, 0x1d53c },  // Eopf;
+  { 1377, 8, 0, 0x0395 },  // Epsilon;
+  { 1385, 6, 0, 0x2a75 },  // Equal;
+  { 1391, 11, 0, 0x2242 },  // EqualTilde;
+  { 1402, 12, 0, 0x21cc },  // Equilibrium;
+  { 1414, 5, 0, 0x2130 },  // Escr;
+  { 1419, 5, 0, 0x2a73 },  // Esim;
+  { 1424, 4, 0, 0x0397 },  // Eta;
+  { 1428, 4, 0, 0x00cb },  // Euml
+  { 1432, 5, 0, 0x00cb },  // Euml;
+  { 1437, 7, 0, 0x2203 },  // Exists;
+  { 1444, 13, 0, 0x2147 },  // ExponentialE;
+  { 1457, 4, 0, 0x0424 },  // Fcy;
+  { 1461, 4, 0, 0x1d509 },  // Ffr;
+  { 1465, 18, 0, 0x25fc },  // FilledSmallSquare;
+  { 1483, 22, 0, 0x25aa },  // FilledVerySmallSquare;
+  { 1505, 5, 0, 0x1d53d },  // Fopf;
+  { 1510, 7, 0, 0x2200 },  // ForAll;
+  { 1517, 11, 0, 0x2131 },  // Fouriertrf;
+  { 1528, 5, 0, 0x2131 },  // Fscr;
+  { 1533, 5, 0, 0x0403 },  // GJcy;
+  { 1538, 2, 0, 0x003e },  // GT
+  { 1540, 3, 0, 0x003e },  // GT;
+  { 1543, 6, 0, 0x0393 },  // Gamma;
+  { 1549, 7, 0, 0x03dc },  // Gammad;
+  { 1556, 7, 0, 0x011e },  // Gbreve;
+  { 1563, 7, 0, 0x0122 },  // Gcedil;
+  { 1570, 6, 0, 0x011c },  // Gcirc;
+  { 1576, 4, 0, 0x0413 },  // Gcy;
+  { 1580, 5, 0, 0x0120 },  // Gdot;
+  { 1585, 4, 0, 0x1d50a },  // Gfr;
+  { 1589, 3, 0, 0x22d9 },  // Gg;
+  { 1592, 5, 0, 0x1d53e },  // Gopf;
+  { 1597, 13, 0, 0x2265 },  // GreaterEqual;
+  { 1610, 17, 0, 0x22db },  // GreaterEqualLess;
+  { 1627, 17, 0, 0x2267 },  // GreaterFullEqual;
+  { 1644, 15, 0, 0x2aa2 },  // GreaterGreater;
+  { 1659, 12, 0, 0x2277 },  // GreaterLess;
+  { 1671, 18, 0, 0x2a7e },  // GreaterSlantEqual;
+  { 1689, 13, 0, 0x2273 },  // GreaterTilde;
+  { 1702, 5, 0, 0x1d4a2 },  // Gscr;
+  { 1707, 3, 0, 0x226b },  // Gt;
+  { 1710, 7, 0, 0x042a },  // HARDcy;
+  { 1717, 6, 0, 0x02c7 },  // Hacek;
+  { 1723, 4, 0, 0x005e },  // Hat;
+  { 1727, 6, 0, 0x0124 },  // Hcirc;
+  { 1733, 4, 0, 0x210c },  // Hfr;
+  { 1737, 13, 0, 0x210b },  // HilbertSpace;
+  { 1750, 5, 0, 0x210d },  // Hopf;
+  { 1755, 15, 0, 0x2500 },  // HorizontalLine;
+  { 1770, 5, 0, 0x210b },  // Hscr;
+  { 1775, 7, 0, 0x0126 },  // Hstrok;
+  { 1782, 13, 0, 0x224e },  // HumpDownHump;
+  { 1795, 10, 0, 0x224f },  // HumpEqual;
+  { 1805, 5, 0, 0x0415 },  // IEcy;
+  { 1810, 6, 0, 0x0132 },  // IJlig;
+  { 1816, 5, 0, 0x0401 },  // IOcy;
+  { 1821, 6, 0, 0x00cd },  // Iacute
+  { 1827, 7, 0, 0x00cd },  // Iacute;
+  { 1834, 5, 0, 0x00ce },  // Icirc
+  { 1839, 6, 0, 0x00ce },  // Icirc;
+  { 1845, 4, 0, 0x0418 },  // Icy;
+  { 1849, 5, 0, 0x0130 },  // Idot;
+  { 1854, 4, 0, 0x2111 },  // Ifr;
+  { 1858, 6, 0, 0x00cc },  // Igrave
+  { 1864, 7, 0, 0x00cc },  // Igrave;
+  { 1871, 3, 0, 0x2111 },  // Im;
+  { 1874, 6, 0, 0x012a },  // Imacr;
+  { 1880, 11, 0, 0x2148 },  // ImaginaryI;
+  { 1891, 8, 0, 0x21d2 },  // Implies;
+  { 1899, 4, 0, 0x222c },  // Int;
+  { 1903, 9, 0, 0x222b },  // Integral;
+  { 1912, 13, 0, 0x22c2 },  // Intersection;
+  { 1925, 15, 0, 0x2063 },  // InvisibleComma;
+  { 1940, 15, 0, 0x2062 },  // InvisibleTimes;
+  { 1955, 6, 0, 0x012e },  // Iogon;
+  { 1961, 5, 0, 0x1d540 },  // Iopf;
+  { 1966, 5, 0, 0x0399 },  // Iota;
+  { 1971, 5, 0, 0x2110 },  // Iscr;
+  { 1976, 7, 0, 0x0128 },  // Itilde;
+  { 1983, 6, 0, 0x0406 },  // Iukcy;
+  { 1989, 4, 0, 0x00cf },  // Iuml
+  { 1993, 5, 0, 0x00cf },  // Iuml;
+  { 1998, 6, 0, 0x0134 },  // Jcirc;
+  { 2004, 4, 0, 0x0419 },  // Jcy;
+  { 2008, 4, 0, 0x1d50d },  // Jfr;
+  { 2012, 5, 0, 0x1d541 },  // Jopf;
+  { 2017, 5, 0, 0x1d4a5 },  // Jscr;
+  { 2022, 7, 0, 0x0408 },  // Jsercy;
+  { 2029, 6, 0, 0x0404 },  // Jukcy;
+  { 2035, 5, 0, 0x0425 },  // KHcy;
+  { 2040, 5, 0, 0x040c },  // KJcy;
+  { 2045, 6, 0, 0x039a },  // Kappa;
+  { 2051, 7, 0, 0x0136 },  // Kcedil;
+  { 2058, 4, 0, 0x041a },  // Kcy;
+  { 2062, 4, 0, 0x1d50e },  // Kfr;
+  { 2066, 5, 0, 0x1d542 },  // Kopf;
+  { 2071, 5, 0, 0x1d4a6 },  // Kscr;
+  { 2076, 5, 0, 0x0409 },  // LJcy;
+  { 2081, 2, 0, 0x003c },  // LT
+  { 2083, 3, 0, 0x003c },  // LT;
+  { 2086, 7, 0, 0x0139 },  // Lacute;
+  { 2093, 7, 0, 0x039b },  // Lambda;
+  { 2100, 5, 0, 0x27ea },  // Lang;
+  { 2105, 11, 0, 0x2112 },  // Laplacetrf;
+  { 2116, 5, 0, 0x219e },  // Larr;
+  { 2121, 7, 0, 0x013d },  // Lcaron;
+  { 2128, 7, 0, 0x013b },  // Lcedil;
+  { 2135, 4, 0, 0x041b },  // Lcy;
+  { 2139, 17, 0, 0x27e8 },  // LeftAngleBracket;
+  { 2156, 10, 0, 0x2190 },  // LeftArrow;
+  { 2166, 13, 0, 0x21e4 },  // LeftArrowBar;
+  { 2179, 20, 0, 0x21c6 },  // LeftArrowRightArrow;
+  { 2199, 12, 0, 0x2308 },  // LeftCeiling;
+  { 2211, 18, 0, 0x27e6 },  // LeftDoubleBracket;
+  { 2229, 18, 0, 0x2961 },  // LeftDownTeeVector;
+  { 2247, 15, 0, 0x21c3 },  // LeftDownVector;
+  { 2262, 18, 0, 0x2959 },  // LeftDownVectorBar;
+  { 2280, 10, 0, 0x230a },  // LeftFloor;
+  { 2290, 15, 0, 0x2194 },  // LeftRightArrow;
+  { 2305, 16, 0, 0x294e },  // LeftRightVector;
+  { 2321, 8, 0, 0x22a3 },  // LeftTee;
+  { 2329, 13, 0, 0x21a4 },  // LeftTeeArrow;
+  { 2342, 14, 0, 0x295a },  // LeftTeeVector;
+  { 2356, 13, 0, 0x22b2 },  // LeftTriangle;
+  { 2369, 16, 0, 0x29cf },  // LeftTriangleBar;
+  { 2385, 18, 0, 0x22b4 },  // LeftTriangleEqual;
+  { 2403, 17, 0, 0x2951 },  // LeftUpDownVector;
+  { 2420, 16, 0, 0x2960 },  // LeftUpTeeVector;
+  { 2436, 13, 0, 0x21bf },  // LeftUpVector;
+  { 2449, 16, 0, 0x2958 },  // LeftUpVectorBar;
+  { 2465, 11, 0, 0x21bc },  // LeftVector;
+  { 2476, 14, 0, 0x2952 },  // LeftVectorBar;
+  { 2490, 10, 0, 0x21d0 },  // Leftarrow;
+  { 2500, 15, 0, 0x21d4 },  // Leftrightarrow;
+  { 2515, 17, 0, 0x22da },  // LessEqualGreater;
+  { 2532, 14, 0, 0x2266 },  // LessFullEqual;
+  { 2546, 12, 0, 0x2276 },  // LessGreater;
+  { 2558, 9, 0, 0x2aa1 },  // LessLess;
+  { 2567, 15, 0, 0x2a7d },  // LessSlantEqual;
+  { 2582, 10, 0, 0x2272 },  // LessTilde;
+  { 2592, 4, 0, 0x1d50f },  // Lfr;
+  { 2596, 3, 0, 0x22d8 },  // Ll;
+  { 2599, 11, 0, 0x21da },  // Lleftarrow;
+  { 2610, 7, 0, 0x013f },  // Lmidot;
+  { 2617, 14, 0, 0x27f5 },  // LongLeftArrow;
+  { 2631, 19, 0, 0x27f7 },  // LongLeftRightArrow;
+  { 2650, 15, 0, 0x27f6 },  // LongRightArrow;
+  { 2665, 14, 0, 0x27f8 },  // Longleftarrow;
+  { 2679, 19, 0, 0x27fa },  // Longleftrightarrow;
+  { 2698, 15, 0, 0x27f9 },  // Longrightarrow;
+  { 2713, 5, 0, 0x1d543 },  // Lopf;
+  { 2718, 15, 0, 0x2199 },  // LowerLeftArrow;
+  { 2733, 16, 0, 0x2198 },  // LowerRightArrow;
+  { 2749, 5, 0, 0x2112 },  // Lscr;
+  { 2754, 4, 0, 0x21b0 },  // Lsh;
+  { 2758, 7, 0, 0x0141 },  // Lstrok;
+  { 2765, 3, 0, 0x226a },  // Lt;
+  { 2768, 4, 0, 0x2905 },  // Map;
+  { 2772, 4, 0, 0x041c },  // Mcy;
+  { 2776, 12, 0, 0x205f },  // MediumSpace;
+  { 2788, 10, 0, 0x2133 },  // Mellintrf;
+  { 2798, 4, 0, 0x1d510 },  // Mfr;
+  { 2802, 10, 0, 0x2213 },  // MinusPlus;
+  { 2812, 5, 0, 0x1d544 },  // Mopf;
+  { 2817, 5, 0, 0x2133 },  // Mscr;
+  { 2822, 3, 0, 0x039c },  // Mu;
+  { 2825, 5, 0, 0x040a },  // NJcy;
+  { 2830, 7, 0, 0x0143 },  // Nacute;
+  { 2837, 7, 0, 0x0147 },  // Ncaron;
+  { 2844, 7, 0, 0x0145 },  // Ncedil;
+  { 2851, 4, 0, 0x041d },  // Ncy;
+  { 2855, 20, 0, 0x200b },  // NegativeMediumSpace;
+  { 2875, 19, 0, 0x200b },  // NegativeThickSpace;
+  { 2894, 18, 0, 0x200b },  // NegativeThinSpace;
+  { 2912, 22, 0, 0x200b },  // NegativeVeryThinSpace;
+  { 2934, 21, 0, 0x226b },  // NestedGreaterGreater;
+  { 2955, 15, 0, 0x226a },  // NestedLessLess;
+  { 2970, 8, 0, 0x000a },  // NewLine;
+  { 2978, 4, 0, 0x1d511 },  // Nfr;
+  { 2982, 8, 0, 0x2060 },  // NoBreak;
+  { 2990, 17, 0, 0x00a0 },  // NonBreakingSpace;
+  { 3007, 5, 0, 0x2115 },  // Nopf;
+  { 3012, 4, 0, 0x2aec },  // Not;
+  { 3016, 13, 0, 0x2262 },  // NotCongruent;
+  { 3029, 10, 0, 0x226d },  // NotCupCap;
+  { 3039, 21, 0, 0x2226 },  // NotDoubleVerticalBar;
+  { 3060, 11, 0, 0x2209 },  // NotElement;
+  { 3071, 9, 0, 0x2260 },  // NotEqual;
+  { 3080, 14, 4, 0x2242 },  // NotEqualTilde;
+  { 3094, 10, 0, 0x2204 },  // NotExists;
+  { 3104, 11, 0, 0x226f },  // NotGreater;
+  { 3115, 16, 0, 0x2271 },  // NotGreaterEqual;
+  { 3131, 20, 4, 0x2267 },  // NotGreaterFullEqual;
+  { 3151, 18, 4, 0x226b },  // NotGreaterGreater;
+  { 3169, 15, 0, 0x2279 },  // NotGreaterLess;
+  { 3184, 21, 4, 0x2a7e },  // NotGreaterSlantEqual;
+  { 3205, 16, 0, 0x2275 },  // NotGreaterTilde;
+  { 3221, 16, 4, 0x224e },  // NotHumpDownHump;
+  { 3237, 13, 4, 0x224f },  // NotHumpEqual;
+  { 3250, 16, 0, 0x22ea },  // NotLeftTriangle;
+  { 3266, 19, 4, 0x29cf },  // NotLeftTriangleBar;
+  { 3285, 21, 0, 0x22ec },  // NotLeftTriangleEqual;
+  { 3306, 8, 0, 0x226e },  // NotLess;
+  { 3314, 13, 0, 0x2270 },  // NotLessEqual;
+  { 3327, 15, 0, 0x2278 },  // NotLessGreater;
+  { 3342, 12, 4, 0x226a },  // NotLessLess;
+  { 3354, 18, 4, 0x2a7d },  // NotLessSlantEqual;
+  { 3372, 13, 0, 0x2274 },  // NotLessTilde;
+  { 3385, 24, 4, 0x2aa2 },  // NotNestedGreaterGreater;
+  { 3409, 18, 4, 0x2aa1 },  // NotNestedLessLess;
+  { 3427, 12, 0, 0x2280 },  // NotPrecedes;
+  { 3439, 17, 4, 0x2aaf },  // NotPrecedesEqual;
+  { 3456, 22, 0, 0x22e0 },  // NotPrecedesSlantEqual;
+  { 3478, 18, 0, 0x220c },  // NotReverseElement;
+  { 3496, 17, 0, 0x22eb },  // NotRightTriangle;
+  { 3513, 20, 4, 0x29d0 },  // NotRightTriangleBar;
+  { 3533, 22, 0, 0x22ed },  // NotRightTriangleEqual;
+  { 3555, 16, 4, 0x228f },  // NotSquareSubset;
+  { 3571, 21, 0, 0x22e2 },  // NotSquareSubsetEqual;
+  { 3592, 18, 4, 0x2290 },  // NotSquareSuperset;
+  { 3610, 23, 0, 0x22e3 },  // NotSquareSupersetEqual;
+  { 3633, 10, 6, 0x2282 },  // NotSubset;
+  { 3643, 15, 0, 0x2288 },  // NotSubsetEqual;
+  { 3658, 12, 0, 0x2281 },  // NotSucceeds;
+  { 3670, 17, 4, 0x2ab0 },  // NotSucceedsEqual;
+  { 3687, 22, 0, 0x22e1 },  // NotSucceedsSlantEqual;
+  { 3709, 17, 4, 0x227f },  // NotSucceedsTilde;
+  { 3726, 12, 6, 0x2283 },  // NotSuperset;
+  { 3738, 17, 0, 0x2289 },  // NotSupersetEqual;
+  { 3755, 9, 0, 0x2241 },  // NotTilde;
+  { 3764, 14, 0, 0x2244 },  // NotTildeEqual;
+  { 3778, 18, 0, 0x2247 },  // NotTildeFullEqual;
+  { 3796, 14, 0, 0x2249 },  // NotTildeTilde;
+  { 3810, 15, 0, 0x2224 },  // NotVerticalBar;
+  { 3825, 5, 0, 0x1d4a9 },  // Nscr;
+  { 3830, 6, 0, 0x00d1 },  // Ntilde
+  { 3836, 7, 0, 0x00d1 },  // Ntilde;
+  { 3843, 3, 0, 0x039d },  // Nu;
+  { 3846, 6, 0, 0x0152 },  // OElig;
+  { 3852, 6, 0, 0x00d3 },  // Oacute
+  { 3858, 7, 0, 0x00d3 },  // Oacute;
+  { 3865, 5, 0, 0x00d4 },  // Ocirc
+  { 3870, 6, 0, 0x00d4 },  // Ocirc;
+  { 3876, 4, 0, 0x041e },  // Ocy;
+  { 3880, 7, 0, 0x0150 },  // Odblac;
+  { 3887, 4, 0, 0x1d512 },  // Ofr;
+  { 3891, 6, 0, 0x00d2 },  // Ograve
+  { 3897, 7, 0, 0x00d2 },  // Ograve;
+  { 3904, 6, 0, 0x014c },  // Omacr;
+  { 3910, 6, 0, 0x03a9 },  // Omega;
+  { 3916, 8, 0, 0x039f },  // Omicron;
+  { 3924, 5, 0, 0x1d546 },  // Oopf;
+  { 3929, 21, 0, 0x201c },  // OpenCurlyDoubleQuote;
+  { 3950, 15, 0, 0x2018 },  // OpenCurlyQuote;
+  { 3965, 3, 0, 0x2a54 },  // Or;
+  { 3968, 5, 0, 0x1d4aa },  // Oscr;
+  { 3973, 6, 0, 0x00d8 },  // Oslash
+  { 3979, 7, 0, 0x00d8 },  // Oslash;
+  { 3986, 6, 0, 0x00d5 },  // Otilde
+  { 3992, 7, 0, 0x00d5 },  // Otilde;
+  { 3999, 7, 0, 0x2a37 },  // Otimes;
+  { 4006, 4, 0, 0x00d6 },  // Ouml
+  { 4010, 5, 0, 0x00d6 },  // Ouml;
+  { 4015, 8, 0, 0x203e },  // OverBar;
+  { 4023, 10, 0, 0x23de },  // OverBrace;
+  { 4033, 12, 0, 0x23b4 },  // OverBracket;
+  { 4045, 16, 0, 0x23dc },  // OverParenthesis;
+  { 4061, 9, 0, 0x2202 },  // PartialD;
+  { 4070, 4, 0, 0x041f },  // Pcy;
+  { 4074, 4, 0, 0x1d513 },  // Pfr;
+  { 4078, 4, 0, 0x03a6 },  // Phi;
+  { 4082, 3, 0, 0x03a0 },  // Pi;
+  { 4085, 10, 0, 0x00b1 },  // PlusMinus;
+  { 4095, 14, 0, 0x210c },  // Poincareplane;
+  { 4109, 5, 0, 0x2119 },  // Popf;
+  { 4114, 3, 0, 0x2abb },  // Pr;
+  { 4117, 9, 0, 0x227a },  // Precedes;
+  { 4126, 14, 0, 0x2aaf },  // PrecedesEqual;
+  { 4140, 19, 0, 0x227c },  // PrecedesSlantEqual;
+  { 4159, 14, 0, 0x227e },  // PrecedesTilde;
+  { 4173, 6, 0, 0x2033 },  // Prime;
+  { 4179, 8, 0, 0x220f },  // Product;
+  { 4187, 11, 0, 0x2237 },  // Proportion;
+  { 4198, 13, 0, 0x221d },  // Proportional;
+  { 4211, 5, 0, 0x1d4ab },  // Pscr;
+  { 4216, 4, 0, 0x03a8 },  // Psi;
+  { 4220, 4, 0, 0x0022 },  // QUOT
+  { 4224, 5, 0, 0x0022 },  // QUOT;
+  { 4229, 4, 0, 0x1d514 },  // Qfr;
+  { 4233, 5, 0, 0x211a },  // Qopf;
+  { 4238, 5, 0, 0x1d4ac },  // Qscr;
+  { 4243, 6, 0, 0x2910 },  // RBarr;
+  { 4249, 3, 0, 0x00ae },  // REG
+  { 4252, 4, 0, 0x00ae },  // REG;
+  { 4256, 7, 0, 0x0154 },  // Racute;
+  { 4263, 5, 0, 0x27eb },  // Rang;
+  { 4268, 5, 0, 0x21a0 },  // Rarr;
+  { 4273, 7, 0, 0x2916 },  // Rarrtl;
+  { 4280, 7, 0, 0x0158 },  // Rcaron;
+  { 4287, 7, 0, 0x0156 },  // Rcedil;
+  { 4294, 4, 0, 0x0420 },  // Rcy;
+  { 4298, 3, 0, 0x211c },  // Re;
+  { 4301, 15, 0, 0x220b },  // ReverseElement;
+  { 4316, 19, 0, 0x21cb },  // ReverseEquilibrium;
+  { 4335, 21, 0, 0x296f },  // ReverseUpEquilibrium;
+  { 4356, 4, 0, 0x211c },  // Rfr;
+  { 4360, 4, 0, 0x03a1 },  // Rho;
+  { 4364, 18, 0, 0x27e9 },  // RightAngleBracket;
+  { 4382, 11, 0, 0x2192 },  // RightArrow;
+  { 4393, 14, 0, 0x21e5 },  // RightArrowBar;
+  { 4407, 20, 0, 0x21c4 },  // RightArrowLeftArrow;
+  { 4427, 13, 0, 0x2309 },  // RightCeiling;
+  { 4440, 19, 0, 0x27e7 },  // RightDoubleBracket;
+  { 4459, 19, 0, 0x295d },  // RightDownTeeVector;
+  { 4478, 16, 0, 0x21c2 },  // RightDownVector;
+  { 4494, 19, 0, 0x2955 },  // RightDownVectorBar;
+  { 4513, 11, 0, 0x230b },  // RightFloor;
+  { 4524, 9, 0, 0x22a2 },  // RightTee;
+  { 4533, 14, 0, 0x21a6 },  // RightTeeArrow;
+  { 4547, 15, 0, 0x295b },  // RightTeeVector;
+  { 4562, 14, 0, 0x22b3 },  // RightTriangle;
+  { 4576, 17, 0, 0x29d0 },  // RightTriangleBar;
+  { 4593, 19, 0, 0x22b5 },  // RightTriangleEqual;
+  { 4612, 18, 0, 0x294f },  // RightUpDownVector;
+  { 4630, 17, 0, 0x295c },  // RightUpTeeVector;
+  { 4647, 14, 0, 0x21be },  // RightUpVector;
+  { 4661, 17, 0, 0x2954 },  // RightUpVectorBar;
+  { 4678, 12, 0, 0x21c0 },  // RightVector;
+  { 4690, 15, 0, 0x2953 },  // RightVectorBar;
+  { 4705, 11, 0, 0x21d2 },  // Rightarrow;
+  { 4716, 5, 0, 0x211d },  // Ropf;
+  { 4721, 13, 0, 0x2970 },  // RoundImplies;
+  { 4734, 12, 0, 0x21db },  // Rrightarrow;
+  { 4746, 5, 0, 0x211b },  // Rscr;
+  { 4751, 4, 0, 0x21b1 },  // Rsh;
+  { 4755, 12, 0, 0x29f4 },  // RuleDelayed;
+  { 4767, 7, 0, 0x0429 },  // SHCHcy;
+  { 4774, 5, 0, 0x0428 },  // SHcy;
+  { 4779, 7, 0, 0x042c },  // SOFTcy;
+  { 4786, 7, 0, 0x015a },  // Sacute;
+  { 4793, 3, 0, 0x2abc },  // Sc;
+  { 4796, 7, 0, 0x0160 },  // Scaron;
+  { 4803, 7, 0, 0x015e },  // Scedil;
+  { 4810, 6, 0, 0x015c },  // Scirc;
+  { 4816, 4, 0, 0x0421 },  // Scy;
+  { 4820, 4, 0, 0x1d516 },  // Sfr;
+  { 4824, 15, 0, 0x2193 },  // ShortDownArrow;
+  { 4839, 15, 0, 0x2190 },  // ShortLeftArrow;
+  { 4854, 16, 0, 0x2192 },  // ShortRightArrow;
+  { 4870, 13, 0, 0x2191 },  // ShortUpArrow;
+  { 4883, 6, 0, 0x03a3 },  // Sigma;
+  { 4889, 12, 0, 0x2218 },  // SmallCircle;
+  { 4901, 5, 0, 0x1d54a },  // Sopf;
+  { 4906, 5, 0, 0x221a },  // Sqrt;
+  { 4911, 7, 0, 0x25a1 },  // Square;
+  { 4918, 19, 0, 0x2293 },  // SquareIntersection;
+  { 4937, 13, 0, 0x228f },  // SquareSubset;
+  { 4950, 18, 0, 0x2291 },  // SquareSubsetEqual;
+  { 4968, 15, 0, 0x2290 },  // SquareSuperset;
+  { 4983, 20, 0, 0x2292 },  // SquareSupersetEqual;
+  { 5003, 12, 0, 0x2294 },  // SquareUnion;
+  { 5015, 5, 0, 0x1d4ae },  // Sscr;
+  { 5020, 5, 0, 0x22c6 },  // Star;
+  { 5025, 4, 0, 0x22d0 },  // Sub;
+  { 5029, 7, 0, 0x22d0 },  // Subset;
+  { 5036, 12, 0, 0x2286 },  // SubsetEqual;
+  { 5048, 9, 0, 0x227b },  // Succeeds;
+  { 5057, 14, 0, 0x2ab0 },  // SucceedsEqual;
+  { 5071, 19, 0, 0x227d },  // SucceedsSlantEqual;
+  { 5090, 14, 0, 0x227f },  // SucceedsTilde;
+  { 5104, 9, 0, 0x220b },  // SuchThat;
+  { 5113, 4, 0, 0x2211 },  // Sum;
+  { 5117, 4, 0, 0x22d1 },  // Sup;
+  { 5121, 9, 0, 0x2283 },  // Superset;
+  { 5130, 14, 0, 0x2287 },  // SupersetEqual;
+  { 5144, 7, 0, 0x22d1 },  // Supset;
+  { 5151, 5, 0, 0x00de },  // THORN
+  { 5156, 6, 0, 0x00de },  // THORN;
+  { 5162, 6, 0, 0x2122 },  // TRADE;
+  { 5168, 6, 0, 0x040b },  // TSHcy;
+  { 5174, 5, 0, 0x0426 },  // TScy;
+  { 5179, 4, 0, 0x0009 },  // Tab;
+  { 5183, 4, 0, 0x03a4 },  // Tau;
+  { 5187, 7, 0, 0x0164 },  // Tcaron;
+  { 5194, 7, 0, 0x0162 },  // Tcedil;
+  { 5201, 4, 0, 0x0422 },  // Tcy;
+  { 5205, 4, 0, 0x1d517 },  // Tfr;
+  { 5209, 10, 0, 0x2234 },  // Therefore;
+  { 5219, 6, 0, 0x0398 },  // Theta;
+  { 5225, 11, 5, 0x205f },  // ThickSpace;
+  { 5236, 10, 0, 0x2009 },  // ThinSpace;
+  { 5246, 6, 0, 0x223c },  // Tilde;
+  { 5252, 11, 0, 0x2243 },  // TildeEqual;
+  { 5263, 15, 0, 0x2245 },  // TildeFullEqual;
+  { 5278, 11, 0, 0x2248 },  // TildeTilde;
+  { 5289, 5, 0, 0x1d54b },  // Topf;
+  { 5294, 10, 0, 0x20db },  // TripleDot;
+  { 5304, 5, 0, 0x1d4af },  // Tscr;
+  { 5309, 7, 0, 0x0166 },  // Tstrok;
+  { 5316, 6, 0, 0x00da },  // Uacute
+  { 5322, 7, 0, 0x00da },  // Uacute;
+  { 5329, 5, 0, 0x219f },  // Uarr;
+  { 5334, 9, 0, 0x2949 },  // Uarrocir;
+  { 5343, 6, 0, 0x040e },  // Ubrcy;
+  { 5349, 7, 0, 0x016c },  // Ubreve;
+  { 5356, 5, 0, 0x00db },  // Ucirc
+  { 5361, 6, 0, 0x00db },  // Ucirc;
+  { 5367, 4, 0, 0x0423 },  // Ucy;
+  { 5371, 7, 0, 0x0170 },  // Udblac;
+  { 5378, 4, 0, 0x1d518 },  // Ufr;
+  { 5382, 6, 0, 0x00d9 },  // Ugrave
+  { 5388, 7, 0, 0x00d9 },  // Ugrave;
+  { 5395, 6, 0, 0x016a },  // Umacr;
+  { 5401, 9, 0, 0x005f },  // UnderBar;
+  { 5410, 11, 0, 0x23df },  // UnderBrace;
+  { 5421, 13, 0, 0x23b5 },  // UnderBracket;
+  { 5434, 17, 0, 0x23dd },  // UnderParenthesis;
+  { 5451, 6, 0, 0x22c3 },  // Union;
+  { 5457, 10, 0, 0x228e },  // UnionPlus;
+  { 5467, 6, 0, 0x0172 },  // Uogon;
+  { 5473, 5, 0, 0x1d54c },  // Uopf;
+  { 5478, 8, 0, 0x2191 },  // UpArrow;
+  { 5486, 11, 0, 0x2912 },  // UpArrowBar;
+  { 5497, 17, 0, 0x21c5 },  // UpArrowDownArrow;
+  { 5514, 12, 0, 0x2195 },  // UpDownArrow;
+  { 5526, 14, 0, 0x296e },  // UpEquilibrium;
+  { 5540, 6, 0, 0x22a5 },  // UpTee;
+  { 5546, 11, 0, 0x21a5 },  // UpTeeArrow;
+  { 5557, 8, 0, 0x21d1 },  // Uparrow;
+  { 5565, 12, 0, 0x21d5 },  // Updownarrow;
+  { 5577, 15, 0, 0x2196 },  // UpperLeftArrow;
+  { 5592, 16, 0, 0x2197 },  // UpperRightArrow;
+  { 5608, 5, 0, 0x03d2 },  // Upsi;
+  { 5613, 8, 0, 0x03a5 },  // Upsilon;
+  { 5621, 6, 0, 0x016e },  // Uring;
+  { 5627, 5, 0, 0x1d4b0 },  // Uscr;
+  { 5632, 7, 0, 0x0168 },  // Utilde;
+  { 5639, 4, 0, 0x00dc },  // Uuml
+  { 5643, 5, 0, 0x00dc },  // Uuml;
+  { 5648, 6, 0, 0x22ab },  // VDash;
+  { 5654, 5, 0, 0x2aeb },  // Vbar;
+  { 5659, 4, 0, 0x0412 },  // Vcy;
+  { 5663, 6, 0, 0x22a9 },  // Vdash;
+  { 5669, 7, 0, 0x2ae6 },  // Vdashl;
+  { 5676, 4, 0, 0x22c1 },  // Vee;
+  { 5680, 7, 0, 0x2016 },  // Verbar;
+  { 5687, 5, 0, 0x2016 },  // Vert;
+  { 5692, 12, 0, 0x2223 },  // VerticalBar;
+  { 5704, 13, 0, 0x007c },  // VerticalLine;
+  { 5717, 18, 0, 0x2758 },  // VerticalSeparator;
+  { 5735, 14, 0, 0x2240 },  // VerticalTilde;
+  { 5749, 14, 0, 0x200a },  // VeryThinSpace;
+  { 5763, 4, 0, 0x1d519 },  // Vfr;
+  { 5767, 5, 0, 0x1d54d },  // Vopf;
+  { 5772, 5, 0, 0x1d4b1 },  // Vscr;
+  { 5777, 7, 0, 0x22aa },  // Vvdash;
+  { 5784, 6, 0, 0x0174 },  // Wcirc;
+  { 5790, 6, 0, 0x22c0 },  // Wedge;
+  { 5796, 4, 0, 0x1d51a },  // Wfr;
+  { 5800, 5, 0, 0x1d54e },  // Wopf;
+  { 5805, 5, 0, 0x1d4b2 },  // Wscr;
+  { 5810, 4, 0, 0x1d51b },  // Xfr;
+  { 5814, 3, 0, 0x039e },  // Xi;
+  { 5817, 5, 0, 0x1d54f },  // Xopf;
+  { 5822, 5, 0, 0x1d4b3 },  // Xscr;
+  { 5827, 5, 0, 0x042f },  // YAcy;
+  { 5832, 5, 0, 0x0407 },  // YIcy;
+  { 5837, 5, 0, 0x042e },  // YUcy;
+  { 5842, 6, 0, 0x00dd },  // Yacute
+  { 5848, 7, 0, 0x00dd },  // Yacute;
+  { 5855, 6, 0, 0x0176 },  // Ycirc;
+  { 5861, 4, 0, 0x042b },  // Ycy;
+  { 5865, 4, 0, 0x1d51c },  // Yfr;
+  { 5869, 5, 0, 0x1d550 },  // Yopf;
+  { 5874, 5, 0, 0x1d4b4 },  // Yscr;
+  { 5879, 5, 0, 0x0178 },  // Yuml;
+  { 5884, 5, 0, 0x0416 },  // ZHcy;
+  { 5889, 7, 0, 0x0179 },  // Zacute;
+  { 5896, 7, 0, 0x017d },  // Zcaron;
+  { 5903, 4, 0, 0x0417 },  // Zcy;
+  { 5907, 5, 0, 0x017b },  // Zdot;
+  { 5912, 15, 0, 0x200b },  // ZeroWidthSpace;
+  { 5927, 5, 0, 0x0396 },  // Zeta;
+  { 5932, 4, 0, 0x2128 },  // Zfr;
+  { 5936, 5, 0, 0x2124 },  // Zopf;
+  { 5941, 5, 0, 0x1d4b5 },  // Zscr;
+  { 5946, 6, 0, 0x00e1 },  // aacute
+  { 5952, 7, 0, 0x00e1 },  // aacute;
+  { 5959, 7, 0, 0x0103 },  // abreve;
+  { 5966, 3, 0, 0x223e },  // ac;
+  { 5969, 4, 3, 0x223e },  // acE;
+  { 5973, 4, 0, 0x223f },  // acd;
+  { 5977, 5, 0, 0x00e2 },  // acirc
+  { 5982, 6, 0, 0x00e2 },  // acirc;
+  { 5988, 5, 0, 0x00b4 },  // acute
+  { 5993, 6, 0, 0x00b4 },  // acute;
+  { 5999, 4, 0, 0x0430 },  // acy;
+  { 6003, 5, 0, 0x00e6 },  // aelig
+  { 6008, 6, 0, 0x00e6 },  // aelig;
+  { 6014, 3, 0, 0x2061 },  // af;
+  { 6017, 4, 0, 0x1d51e },  // afr;
+  { 6021, 6, 0, 0x00e0 },  // agrave
+  { 6027, 7, 0, 0x00e0 },  // agrave;
+  { 6034, 8, 0, 0x2135 },  // alefsym;
+  { 6042, 6, 0, 0x2135 },  // aleph;
+  { 6048, 6, 0, 0x03b1 },  // alpha;
+  { 6054, 6, 0, 0x0101 },  // amacr;
+  { 6060, 6, 0, 0x2a3f },  // amalg;
+  { 6066, 3, 0, 0x0026 },  // amp
+  { 6069, 4, 0, 0x0026 },  // amp;
+  { 6073, 4, 0, 0x2227 },  // and;
+  { 6077, 7, 0, 0x2a55 },  // andand;
+  { 6084, 5, 0, 0x2a5c },  // andd;
+  { 6089, 9, 0, 0x2a58 },  // andslope;
+  { 6098, 5, 0, 0x2a5a },  // andv;
+  { 6103, 4, 0, 0x2220 },  // ang;
+  { 6107, 5, 0, 0x29a4 },  // ange;
+  { 6112, 6, 0, 0x2220 },  // angle;
+  { 6118, 7, 0, 0x2221 },  // angmsd;
+  { 6125, 9, 0, 0x29a8 },  // angmsdaa;
+  { 6134, 9, 0, 0x29a9 },  // angmsdab;
+  { 6143, 9, 0, 0x29aa },  // angmsdac;
+  { 6152, 9, 0, 0x29ab },  // angmsdad;
+  { 6161, 9, 0, 0x29ac },  // angmsdae;
+  { 6170, 9, 0, 0x29ad },  // angmsdaf;
+  { 6179, 9, 0, 0x29ae },  // angmsdag;
+  { 6188, 9, 0, 0x29af },  // angmsdah;
+  { 6197, 6, 0, 0x221f },  // angrt;
+  { 6203, 8, 0, 0x22be },  // angrtvb;
+  { 6211, 9, 0, 0x299d },  // angrtvbd;
+  { 6220, 7, 0, 0x2222 },  // angsph;
+  { 6227, 6, 0, 0x00c5 },  // angst;
+  { 6233, 8, 0, 0x237c },  // angzarr;
+  { 6241, 6, 0, 0x0105 },  // aogon;
+  { 6247, 5, 0, 0x1d552 },  // aopf;
+  { 6252, 3, 0, 0x2248 },  // ap;
+  { 6255, 4, 0, 0x2a70 },  // apE;
+  { 6259, 7, 0, 0x2a6f },  // apacir;
+  { 6266, 4, 0, 0x224a },  // ape;
+  { 6270, 5, 0, 0x224b },  // apid;
+  { 6275, 5, 0, 0x0027 },  // apos;
+  { 6280, 7, 0, 0x2248 },  // approx;
+  { 6287, 9, 0, 0x224a },  // approxeq;
+  { 6296, 5, 0, 0x00e5 },  // aring
+  { 6301, 6, 0, 0x00e5 },  // aring;
+  { 6307, 5, 0, 0x1d4b6 },  // ascr;
+  { 6312, 4, 0, 0x002a },  // ast;
+  { 6316, 6, 0, 0x2248 },  // asymp;
+  { 6322, 8, 0, 0x224d },  // asympeq;
+  { 6330, 6, 0, 0x00e3 },  // atilde
+  { 6336, 7, 0, 0x00e3 },  // atilde;
+  { 6343, 4, 0, 0x00e4 },  // auml
+  { 6347, 5, 0, 0x00e4 },  // auml;
+  { 6352, 9, 0, 0x2233 },  // awconint;
+  { 6361, 6, 0, 0x2a11 },  // awint;
+  { 6367, 5, 0, 0x2aed },  // bNot;
+  { 6372, 9, 0, 0x224c },  // backcong;
+  { 6381, 12, 0, 0x03f6 },  // backepsilon;
+  { 6393, 10, 0, 0x2035 },  // backprime;
+  { 6403, 8, 0, 0x223d },  // backsim;
+  { 6411, 10, 0, 0x22cd },  // backsimeq;
+  { 6421, 7, 0, 0x22bd },  // barvee;
+  { 6428, 7, 0, 0x2305 },  // barwed;
+  { 6435, 9, 0, 0x2305 },  // barwedge;
+  { 6444, 5, 0, 0x23b5 },  // bbrk;
+  { 6449, 9, 0, 0x23b6 },  // bbrktbrk;
+  { 6458, 6, 0, 0x224c },  // bcong;
+  { 6464, 4, 0, 0x0431 },  // bcy;
+  { 6468, 6, 0, 0x201e },  // bdquo;
+  { 6474, 7, 0, 0x2235 },  // becaus;
+  { 6481, 8, 0, 0x2235 },  // because;
+  { 6489, 8, 0, 0x29b0 },  // bemptyv;
+  { 6497, 6, 0, 0x03f6 },  // bepsi;
+  { 6503, 7, 0, 0x212c },  // bernou;
+  { 6510, 5, 0, 0x03b2 },  // beta;
+  { 6515, 5, 0, 0x2136 },  // beth;
+  { 6520, 8, 0, 0x226c },  // between;
+  { 6528, 4, 0, 0x1d51f },  // bfr;
+  { 6532, 7, 0, 0x22c2 },  // bigcap;
+  { 6539, 8, 0, 0x25ef },  // bigcirc;
+  { 6547, 7, 0, 0x22c3 },  // bigcup;
+  { 6554, 8, 0, 0x2a00 },  // bigodot;
+  { 6562, 9, 0, 0x2a01 },  // bigoplus;
+  { 6571, 10, 0, 0x2a02 },  // bigotimes;
+  { 6581, 9, 0, 0x2a06 },  // bigsqcup;
+  { 6590, 8, 0, 0x2605 },  // bigstar;
+  { 6598, 16, 0, 0x25bd },  // bigtriangledown;
+  { 6614, 14, 0, 0x25b3 },  // bigtriangleup;
+  { 6628, 9, 0, 0x2a04 },  // biguplus;
+  { 6637, 7, 0, 0x22c1 },  // bigvee;
+  { 6644, 9, 0, 0x22c0 },  // bigwedge;
+  { 6653, 7, 0, 0x290d },  // bkarow;
+  { 6660, 13, 0, 0x29eb },  // blacklozenge;
+  { 6673, 12, 0, 0x25aa },  // blacksquare;
+  { 6685, 14, 0, 0x25b4 },  // blacktriangle;
+  { 6699, 18, 0, 0x25be },  // blacktriangledown;
+  { 6717, 18, 0, 0x25c2 },  // blacktriangleleft;
+  { 6735, 19, 0, 0x25b8 },  // blacktriangleright;
+  { 6754, 6, 0, 0x2423 },  // blank;
+  { 6760, 6, 0, 0x2592 },  // blk12;
+  { 6766, 6, 0, 0x2591 },  // blk14;
+  { 6772, 6, 0, 0x2593 },  // blk34;
+  { 6778, 6, 0, 0x2588 },  // block;
+  { 6784, 4, 7, 0x003d },  // bne;
+  { 6788, 8, 7, 0x2261 },  // bnequiv;
+  { 6796, 5, 0, 0x2310 },  // bnot;
+  { 6801, 5, 0, 0x1d553 },  // bopf;
+  { 6806, 4, 0, 0x22a5 },  // bot;
+  { 6810, 7, 0, 0x22a5 },  // bottom;
+  { 6817, 7, 0, 0x22c8 },  // bowtie;
+  { 6824, 6, 0, 0x2557 },  // boxDL;
+  { 6830, 6, 0, 0x2554 },  // boxDR;
+  { 6836, 6, 0, 0x2556 },  // boxDl;
+  { 6842, 6, 0, 0x2553 },  // boxDr;
+  { 6848, 5, 0, 0x2550 },  // boxH;
+  { 6853, 6, 0, 0x2566 },  // boxHD;
+  { 6859, 6, 0, 0x2569 },  // boxHU;
+  { 6865, 6, 0, 0x2564 },  // boxHd;
+  { 6871, 6, 0, 0x2567 },  // boxHu;
+  { 6877, 6, 0, 0x255d },  // boxUL;
+  { 6883, 6, 0, 0x255a },  // boxUR;
+  { 6889, 6, 0, 0x255c },  // boxUl;
+  { 6895, 6, 0, 0x2559 },  // boxUr;
+  { 6901, 5, 0, 0x2551 },  // boxV;
+  { 6906, 6, 0, 0x256c },  // boxVH;
+  { 6912, 6, 0, 0x2563 },  // boxVL;
+  { 6918, 6, 0, 0x2560 },  // boxVR;
+  { 6924, 6, 0, 0x256b },  // boxVh;
+  { 6930, 6, 0, 0x2562 },  // boxVl;
+  { 6936, 6, 0, 0x255f },  // boxVr;
+  { 6942, 7, 0, 0x29c9 },  // boxbox;
+  { 6949, 6, 0, 0x2555 },  // boxdL;
+  { 6955, 6, 0, 0x2552 },  // boxdR;
+  { 6961, 6, 0, 0x2510 },  // boxdl;
+  { 6967, 6, 0, 0x250c },  // boxdr;
+  { 6973, 5, 0, 0x2500 },  // boxh;
+  { 6978, 6, 0, 0x2565 },  // boxhD;
+  { 6984, 6, 0, 0x2568 },  // boxhU;
+  { 6990, 6, 0, 0x252c },  // boxhd;
+  { 6996, 6, 0, 0x2534 },  // boxhu;
+  { 7002, 9, 0, 0x229f },  // boxminus;
+  { 7011, 8, 0, 0x229e },  // boxplus;
+  { 7019, 9, 0, 0x22a0 },  // boxtimes;
+  { 7028, 6, 0, 0x255b },  // boxuL;
+  { 7034, 6, 0, 0x2558 },  // boxuR;
+  { 7040, 6, 0, 0x2518 },  // boxul;
+  { 7046, 6, 0, 0x2514 },  // boxur;
+  { 7052, 5, 0, 0x2502 },  // boxv;
+  { 7057, 6, 0, 0x256a },  // boxvH;
+  { 7063, 6, 0, 0x2561 },  // boxvL;
+  { 7069, 6, 0, 0x255e },  // boxvR;
+  { 7075, 6, 0, 0x253c },  // boxvh;
+  { 7081, 6, 0, 0x2524 },  // boxvl;
+  { 7087, 6, 0, 0x251c },  // boxvr;
+  { 7093, 7, 0, 0x2035 },  // bprime;
+  { 7100, 6, 0, 0x02d8 },  // breve;
+  { 7106, 6, 0, 0x00a6 },  // brvbar
+  { 7112, 7, 0, 0x00a6 },  // brvbar;
+  { 7119, 5, 0, 0x1d4b7 },  // bscr;
+  { 7124, 6, 0, 0x204f },  // bsemi;
+  { 7130, 5, 0, 0x223d },  // bsim;
+  { 7135, 6, 0, 0x22cd },  // bsime;
+  { 7141, 5, 0, 0x005c },  // bsol;
+  { 7146, 6, 0, 0x29c5 },  // bsolb;
+  { 7152, 9, 0, 0x27c8 },  // bsolhsub;
+  { 7161, 5, 0, 0x2022 },  // bull;
+  { 7166, 7, 0, 0x2022 },  // bullet;
+  { 7173, 5, 0, 0x224e },  // bump;
+  { 7178, 6, 0, 0x2aae },  // bumpE;
+  { 7184, 6, 0, 0x224f },  // bumpe;
+  { 7190, 7, 0, 0x224f },  // bumpeq;
+  { 7197, 7, 0, 0x0107 },  // cacute;
+  { 7204, 4, 0, 0x2229 },  // cap;
+  { 7208, 7, 0, 0x2a44 },  // capand;
+  { 7215, 9, 0, 0x2a49 },  // capbrcup;
+  { 7224, 7, 0, 0x2a4b },  // capcap;
+  { 7231, 7, 0, 0x2a47 },  // capcup;
+  { 7238, 7, 0, 0x2a40 },  // capdot;
+  { 7245, 5, 8, 0x2229 },  // caps;
+  { 7250, 6, 0, 0x2041 },  // caret;
+  { 7256, 6, 0, 0x02c7 },  // caron;
+  { 7262, 6, 0, 0x2a4d },  // ccaps;
+  { 7268, 7, 0, 0x010d },  // ccaron;
+  { 7275, 6, 0, 0x00e7 },  // ccedil
+  { 7281, 7, 0, 0x00e7 },  // ccedil;
+  { 7288, 6, 0, 0x0109 },  // ccirc;
+  { 7294, 6, 0, 0x2a4c },  // ccups;
+  { 7300, 8, 0, 0x2a50 },  // ccupssm;
+  { 7308, 5, 0, 0x010b },  // cdot;
+  { 7313, 5, 0, 0x00b8 },  // cedil
+  { 7318, 6, 0, 0x00b8 },  // cedil;
+  { 7324, 8, 0, 0x29b2 },  // cemptyv;
+  { 7332, 4, 0, 0x00a2 },  // cent
+  { 7336, 5, 0, 0x00a2 },  // cent;
+  { 7341, 10, 0, 0x00b7 },  // centerdot;
+  { 7351, 4, 0, 0x1d520 },  // cfr;
+  { 7355, 5, 0, 0x0447 },  // chcy;
+  { 7360, 6, 0, 0x2713 },  // check;
+  { 7366, 10, 0, 0x2713 },  // checkmark;
+  { 7376, 4, 0, 0x03c7 },  // chi;
+  { 7380, 4, 0, 0x25cb },  // cir;
+  { 7384, 5, 0, 0x29c3 },  // cirE;
+  { 7389, 5, 0, 0x02c6 },  // circ;
+  { 7394, 7, 0, 0x2257 },  // circeq;
+  { 7401, 16, 0, 0x21ba },  // circlearrowleft;
+  { 7417, 17, 0, 0x21bb },  // circlearrowright;
+  { 7434, 9, 0, 0x00ae },  // circledR;
+  { 7443, 9, 0, 0x24c8 },  // circledS;
+  { 7452, 11, 0, 0x229b },  // circledast;
+  { 7463, 12, 0, 0x229a },  // circledcirc;
+  { 7475, 12, 0, 0x229d },  // circleddash;
+  { 7487, 5, 0, 0x2257 },  // cire;
+  { 7492, 9, 0, 0x2a10 },  // cirfnint;
+  { 7501, 7, 0, 0x2aef },  // cirmid;
+  { 7508, 8, 0, 0x29c2 },  // cirscir;
+  { 7516, 6, 0, 0x2663 },  // clubs;
+  { 7522, 9, 0, 0x2663 },  // clubsuit;
+  { 7531, 6, 0, 0x003a },  // colon;
+  { 7537, 7, 0, 0x2254 },  // colone;
+  { 7544, 8, 0, 0x2254 },  // coloneq;
+  { 7552, 6, 0, 0x002c },  // comma;
+  { 7558, 7, 0, 0x0040 },  // commat;
+  { 7565, 5, 0, 0x2201 },  // comp;
+  { 7570, 7, 0, 0x2218 },  // compfn;
+  { 7577, 11, 0, 0x2201 },  // complement;
+  { 7588, 10, 0, 0x2102 },  // complexes;
+  { 7598, 5, 0, 0x2245 },  // cong;
+  { 7603, 8, 0, 0x2a6d },  // congdot;
+  { 7611, 7, 0, 0x222e },  // conint;
+  { 7618, 5, 0, 0x1d554 },  // copf;
+  { 7623, 7, 0, 0x2210 },  // coprod;
+  { 7630, 4, 0, 0x00a9 },  // copy
+  { 7634, 5, 0, 0x00a9 },  // copy;
+  { 7639, 7, 0, 0x2117 },  // copysr;
+  { 7646, 6, 0, 0x21b5 },  // crarr;
+  { 7652, 6, 0, 0x2717 },  // cross;
+  { 7658, 5, 0, 0x1d4b8 },  // cscr;
+  { 7663, 5, 0, 0x2acf },  // csub;
+  { 7668, 6, 0, 0x2ad1 },  // csube;
+  { 7674, 5, 0, 0x2ad0 },  // csup;
+  { 7679, 6, 0, 0x2ad2 },  // csupe;
+  { 7685, 6, 0, 0x22ef },  // ctdot;
+  { 7691, 8, 0, 0x2938 },  // cudarrl;
+  { 7699, 8, 0, 0x2935 },  // cudarrr;
+  { 7707, 6, 0, 0x22de },  // cuepr;
+  { 7713, 6, 0, 0x22df },  // cuesc;
+  { 7719, 7, 0, 0x21b6 },  // cularr;
+  { 7726, 8, 0, 0x293d },  // cularrp;
+  { 7734, 4, 0, 0x222a },  // cup;
+  { 7738, 9, 0, 0x2a48 },  // cupbrcap;
+  { 7747, 7, 0, 0x2a46 },  // cupcap;
+  { 7754, 7, 0, 0x2a4a },  // cupcup;
+  { 7761, 7, 0, 0x228d },  // cupdot;
+  { 7768, 6, 0, 0x2a45 },  // cupor;
+  { 7774, 5, 8, 0x222a },  // cups;
+  { 7779, 7, 0, 0x21b7 },  // curarr;
+  { 7786, 8, 0, 0x293c },  // curarrm;
+  { 7794, 12, 0, 0x22de },  // curlyeqprec;
+  { 7806, 12, 0, 0x22df },  // curlyeqsucc;
+  { 7818, 9, 0, 0x22ce },  // curlyvee;
+  { 7827, 11, 0, 0x22cf },  // curlywedge;
+  { 7838, 6, 0, 0x00a4 },  // curren
+  { 7844, 7, 0, 0x00a4 },  // curren;
+  { 7851, 15, 0, 0x21b6 },  // curvearrowleft;
+  { 7866, 16, 0, 0x21b7 },  // curvearrowright;
+  { 7882, 6, 0, 0x22ce },  // cuvee;
+  { 7888, 6, 0, 0x22cf },  // cuwed;
+  { 7894, 9, 0, 0x2232 },  // cwconint;
+  { 7903, 6, 0, 0x2231 },  // cwint;
+  { 7909, 7, 0, 0x232d },  // cylcty;
+  { 7916, 5, 0, 0x21d3 },  // dArr;
+  { 7921, 5, 0, 0x2965 },  // dHar;
+  { 7926, 7, 0, 0x2020 },  // dagger;
+  { 7933, 7, 0, 0x2138 },  // daleth;
+  { 7940, 5, 0, 0x2193 },  // darr;
+  { 7945, 5, 0, 0x2010 },  // dash;
+  { 7950, 6, 0, 0x22a3 },  // dashv;
+  { 7956, 8, 0, 0x290f },  // dbkarow;
+  { 7964, 6, 0, 0x02dd },  // dblac;
+  { 7970, 7, 0, 0x010f },  // dcaron;
+  { 7977, 4, 0, 0x0434 },  // dcy;
+  { 7981, 3, 0, 0x2146 },  // dd;
+  { 7984, 8, 0, 0x2021 },  // ddagger;
+  { 7992, 6, 0, 0x21ca },  // ddarr;
+  { 7998, 8, 0, 0x2a77 },  // ddotseq;
+  { 8006, 3, 0, 0x00b0 },  // deg
+  { 8009, 4, 0, 0x00b0 },  // deg;
+  { 8013, 6, 0, 0x03b4 },  // delta;
+  { 8019, 8, 0, 0x29b1 },  // demptyv;
+  { 8027, 7, 0, 0x297f },  // dfisht;
+  { 8034, 4, 0, 0x1d521 },  // dfr;
+  { 8038, 6, 0, 0x21c3 },  // dharl;
+  { 8044, 6, 0, 0x21c2 },  // dharr;
+  { 8050, 5, 0, 0x22c4 },  // diam;
+  { 8055, 8, 0, 0x22c4 },  // diamond;
+  { 8063, 12, 0, 0x2666 },  // diamondsuit;
+  { 8075, 6, 0, 0x2666 },  // diams;
+  { 8081, 4, 0, 0x00a8 },  // die;
+  { 8085, 8, 0, 0x03dd },  // digamma;
+  { 8093, 6, 0, 0x22f2 },  // disin;
+  { 8099, 4, 0, 0x00f7 },  // div;
+  { 8103, 6, 0, 0x00f7 },  // divide
+  { 8109, 7, 0, 0x00f7 },  // divide;
+  { 8116, 14, 0, 0x22c7 },  // divideontimes;
+  { 8130, 7, 0, 0x22c7 },  // divonx;
+  { 8137, 5, 0, 0x0452 },  // djcy;
+  { 8142, 7, 0, 0x231e },  // dlcorn;
+  { 8149, 7, 0, 0x230d },  // dlcrop;
+  { 8156, 7, 0, 0x0024 },  // dollar;
+  { 8163, 5, 0, 0x1d555 },  // dopf;
+  { 8168, 4, 0, 0x02d9 },  // dot;
+  { 8172, 6, 0, 0x2250 },  // doteq;
+  { 8178, 9, 0, 0x2251 },  // doteqdot;
+  { 8187, 9, 0, 0x2238 },  // dotminus;
+  { 8196, 8, 0, 0x2214 },  // dotplus;
+  { 8204, 10, 0, 0x22a1 },  // dotsquare;
+  { 8214, 15, 0, 0x2306 },  // doublebarwedge;
+  { 8229, 10, 0, 0x2193 },  // downarrow;
+  { 8239, 15, 0, 0x21ca },  // downdownarrows;
+  { 8254, 16, 0, 0x21c3 },  // downharpoonleft;
+  { 8270, 17, 0, 0x21c2 },  // downharpoonright;
+  { 8287, 9, 0, 0x2910 },  // drbkarow;
+  { 8296, 7, 0, 0x231f },  // drcorn;
+  { 8303, 7, 0, 0x230c },  // drcrop;
+  { 8310, 5, 0, 0x1d4b9 },  // dscr;
+  { 8315, 5, 0, 0x0455 },  // dscy;
+  { 8320, 5, 0, 0x29f6 },  // dsol;
+  { 8325, 7, 0, 0x0111 },  // dstrok;
+  { 8332, 6, 0, 0x22f1 },  // dtdot;
+  { 8338, 5, 0, 0x25bf },  // dtri;
+  { 8343, 6, 0, 0x25be },  // dtrif;
+  { 8349, 6, 0, 0x21f5 },  // duarr;
+  { 8355, 6, 0, 0x296f },  // duhar;
+  { 8361, 8, 0, 0x29a6 },  // dwangle;
+  { 8369, 5, 0, 0x045f },  // dzcy;
+  { 8374, 9, 0, 0x27ff },  // dzigrarr;
+  { 8383, 6, 0, 0x2a77 },  // eDDot;
+  { 8389, 5, 0, 0x2251 },  // eDot;
+  { 8394, 6, 0, 0x00e9 },  // eacute
+  { 8400, 7, 0, 0x00e9 },  // eacute;
+  { 8407, 7, 0, 0x2a6e },  // easter;
+  { 8414, 7, 0, 0x011b },  // ecaron;
+  { 8421, 5, 0, 0x2256 },  // ecir;
+  { 8426, 5, 0, 0x00ea },  // ecirc
+  { 8431, 6, 0, 0x00ea },  // ecirc;
+  { 8437, 7, 0, 0x2255 },  // ecolon;
+  { 8444, 4, 0, 0x044d },  // ecy;
+  { 8448, 5, 0, 0x0117 },  // edot;
+  { 8453, 3, 0, 0x2147 },  // ee;
+  { 8456, 6, 0, 0x2252 },  // efDot;
+  { 8462, 4, 0, 0x1d522 },  // efr;
+  { 8466, 3, 0, 0x2a9a },  // eg;
+  { 8469, 6, 0, 0x00e8 },  // egrave
+  { 8475, 7, 0, 0x00e8 },  // egrave;
+  { 8482, 4, 0, 0x2a96 },  // egs;
+  { 8486, 7, 0, 0x2a98 },  // egsdot;
+  { 8493, 3, 0, 0x2a99 },  // el;
+  { 8496, 9, 0, 0x23e7 },  // elinters;
+  { 8505, 4, 0, 0x2113 },  // ell;
+  { 8509, 4, 0, 0x2a95 },  // els;
+  { 8513, 7, 0, 0x2a97 },  // elsdot;
+  { 8520, 6, 0, 0x0113 },  // emacr;
+  { 8526, 6, 0, 0x2205 },  // empty;
+  { 8532, 9, 0, 0x2205 },  // emptyset;
+  { 8541, 7, 0, 0x2205 },  // emptyv;
+  { 8548, 7, 0, 0x2004 },  // emsp13;
+  { 8555, 7, 0, 0x2005 },  // emsp14;
+  { 8562, 5, 0, 0x2003 },  // emsp;
+  { 8567, 4, 0, 0x014b },  // eng;
+  { 8571, 5, 0, 0x2002 },  // ensp;
+  { 8576, 6, 0, 0x0119 },  // eogon;
+  { 8582, 5, 0, 0x1d556 },  // eopf;
+  { 8587, 5, 0, 0x22d5 },  // epar;
+  { 8592, 7, 0, 0x29e3 },  // eparsl;
+  { 8599, 6, 0, 0x2a71 },  // eplus;
+  { 8605, 5, 0, 0x03b5 },  // epsi;
+  { 8610, 8, 0, 0x03b5 },  // epsilon;
+  { 8618, 6, 0, 0x03f5 },  // epsiv;
+  { 8624, 7, 0, 0x2256 },  // eqcirc;
+  { 8631, 8, 0, 0x2255 },  // eqcolon;
+  { 8639, 6, 0, 0x2242 },  // eqsim;
+  { 8645, 11, 0, 0x2a96 },  // eqslantgtr;
+  { 8656, 12, 0, 0x2a95 },  // eqslantless;
+  { 8668, 7, 0, 0x003d },  // equals;
+  { 8675, 7, 0, 0x225f },  // equest;
+  { 8682, 6, 0, 0x2261 },  // equiv;
+  { 8688, 8, 0, 0x2a78 },  // equivDD;
+  { 8696, 9, 0, 0x29e5 },  // eqvparsl;
+  { 8705, 6, 0, 0x2253 },  // erDot;
+  { 8711, 6, 0, 0x2971 },  // erarr;
+  { 8717, 5, 0, 0x212f },  // escr;
+  { 8722, 6, 0, 0x2250 },  // esdot;
+  { 8728, 5, 0, 0x2242 },  // esim;
+  { 8733, 4, 0, 0x03b7 },  // eta;
+  { 8737, 3, 0, 0x00f0 },  // eth
+  { 8740, 4, 0, 0x00f0 },  // eth;
+  { 8744, 4, 0, 0x00eb },  // euml
+  { 8748, 5, 0, 0x00eb },  // euml;
+  { 8753, 5, 0, 0x20ac },  // euro;
+  { 8758, 5, 0, 0x0021 },  // excl;
+  { 8763, 6, 0, 0x2203 },  // exist;
+  { 8769, 12, 0, 0x2130 },  // expectation;
+  { 8781, 13, 0, 0x2147 },  // exponentiale;
+  { 8794, 14, 0, 0x2252 },  // fallingdotseq;
+  { 8808, 4, 0, 0x0444 },  // fcy;
+  { 8812, 7, 0, 0x2640 },  // female;
+  { 8819, 7, 0, 0xfb03 },  // ffilig;
+  { 8826, 6, 0, 0xfb00 },  // fflig;
+  { 8832, 7, 0, 0xfb04 },  // ffllig;
+  { 8839, 4, 0, 0x1d523 },  // ffr;
+  { 8843, 6, 0, 0xfb01 },  // filig;
+  { 8849, 6, 1, 0x0066 },  // fjlig;
+  { 8855, 5, 0, 0x266d },  // flat;
+  { 8860, 6, 0, 0xfb02 },  // fllig;
+  { 8866, 6, 0, 0x25b1 },  // fltns;
+  { 8872, 5, 0, 0x0192 },  // fnof;
+  { 8877, 5, 0, 0x1d557 },  // fopf;
+  { 8882, 7, 0, 0x2200 },  // forall;
+  { 8889, 5, 0, 0x22d4 },  // fork;
+  { 8894, 6, 0, 0x2ad9 },  // forkv;
+  { 8900, 9, 0, 0x2a0d },  // fpartint;
+  { 8909, 6, 0, 0x00bd },  // frac12
+  { 8915, 7, 0, 0x00bd },  // frac12;
+  { 8922, 7, 0, 0x2153 },  // frac13;
+  { 8929, 6, 0, 0x00bc },  // frac14
+  { 8935, 7, 0, 0x00bc },  // frac14;
+  { 8942, 7, 0, 0x2155 },  // frac15;
+  { 8949, 7, 0, 0x2159 },  // frac16;
+  { 8956, 7, 0, 0x215b },  // frac18;
+  { 8963, 7, 0, 0x2154 },  // frac23;
+  { 8970, 7, 0, 0x2156 },  // frac25;
+  { 8977, 6, 0, 0x00be },  // frac34
+  { 8983, 7, 0, 0x00be },  // frac34;
+  { 8990, 7, 0, 0x2157 },  // frac35;
+  { 8997, 7, 0, 0x215c },  // frac38;
+  { 9004, 7, 0, 0x2158 },  // frac45;
+  { 9011, 7, 0, 0x215a },  // frac56;
+  { 9018, 7, 0, 0x215d },  // frac58;
+  { 9025, 7, 0, 0x215e },  // frac78;
+  { 9032, 6, 0, 0x2044 },  // frasl;
+  { 9038, 6, 0, 0x2322 },  // frown;
+  { 9044, 5, 0, 0x1d4bb },  // fscr;
+  { 9049, 3, 0, 0x2267 },  // gE;
+  { 9052, 4, 0, 0x2a8c },  // gEl;
+  { 9056, 7, 0, 0x01f5 },  // gacute;
+  { 9063, 6, 0, 0x03b3 },  // gamma;
+  { 9069, 7, 0, 0x03dd },  // gammad;
+  { 9076, 4, 0, 0x2a86 },  // gap;
+  { 9080, 7, 0, 0x011f },  // gbreve;
+  { 9087, 6, 0, 0x011d },  // gcirc;
+  { 9093, 4, 0, 0x0433 },  // gcy;
+  { 9097, 5, 0, 0x0121 },  // gdot;
+  { 9102, 3, 0, 0x2265 },  // ge;
+  { 9105, 4, 0, 0x22db },  // gel;
+  { 9109, 4, 0, 0x2265 },  // geq;
+  { 9113, 5, 0, 0x2267 },  // geqq;
+  { 9118, 9, 0, 0x2a7e },  // geqslant;
+  { 9127, 4, 0, 0x2a7e },  // ges;
+  { 9131, 6, 0, 0x2aa9 },  // gescc;
+  { 9137, 7, 0, 0x2a80 },  // gesdot;
+  { 9144, 8, 0, 0x2a82 },  // gesdoto;
+  { 9152, 9, 0, 0x2a84 },  // gesdotol;
+  { 9161, 5, 8, 0x22db },  // gesl;
+  { 9166, 7, 0, 0x2a94 },  // gesles;
+  { 9173, 4, 0, 0x1d524 },  // gfr;
+  { 9177, 3, 0, 0x226b },  // gg;
+  { 9180, 4, 0, 0x22d9 },  // ggg;
+  { 9184, 6, 0, 0x2137 },  // gimel;
+  { 9190, 5, 0, 0x0453 },  // gjcy;
+  { 9195, 3, 0, 0x2277 },  // gl;
+  { 9198, 4, 0, 0x2a92 },  // glE;
+  { 9202, 4, 0, 0x2aa5 },  // gla;
+  { 9206, 4, 0, 0x2aa4 },  // glj;
+  { 9210, 4, 0, 0x2269 },  // gnE;
+  { 9214, 5, 0, 0x2a8a },  // gnap;
+  { 9219, 9, 0, 0x2a8a },  // gnapprox;
+  { 9228, 4, 0, 0x2a88 },  // gne;
+  { 9232, 5, 0, 0x2a88 },  // gneq;
+  { 9237, 6, 0, 0x2269 },  // gneqq;
+  { 9243, 6, 0, 0x22e7 },  // gnsim;
+  { 9249, 5, 0, 0x1d558 },  // gopf;
+  { 9254, 6, 0, 0x0060 },  // grave;
+  { 9260, 5, 0, 0x210a },  // gscr;
+  { 9265, 5, 0, 0x2273 },  // gsim;
+  { 9270, 6, 0, 0x2a8e },  // gsime;
+  { 9276, 6, 0, 0x2a90 },  // gsiml;
+  { 9282, 2, 0, 0x003e },  // gt
+  { 9284, 3, 0, 0x003e },  // gt;
+  { 9287, 5, 0, 0x2aa7 },  // gtcc;
+  { 9292, 6, 0, 0x2a7a },  // gtcir;
+  { 9298, 6, 0, 0x22d7 },  // gtdot;
+  { 9304, 7, 0, 0x2995 },  // gtlPar;
+  { 9311, 8, 0, 0x2a7c },  // gtquest;
+  { 9319, 10, 0, 0x2a86 },  // gtrapprox;
+  { 9329, 7, 0, 0x2978 },  // gtrarr;
+  { 9336, 7, 0, 0x22d7 },  // gtrdot;
+  { 9343, 10, 0, 0x22db },  // gtreqless;
+  { 9353, 11, 0, 0x2a8c },  // gtreqqless;
+  { 9364, 8, 0, 0x2277 },  // gtrless;
+  { 9372, 7, 0, 0x2273 },  // gtrsim;
+  { 9379, 10, 8, 0x2269 },  // gvertneqq;
+  { 9389, 5, 8, 0x2269 },  // gvnE;
+  { 9394, 5, 0, 0x21d4 },  // hArr;
+  { 9399, 7, 0, 0x200a },  // hairsp;
+  { 9406, 5, 0, 0x00bd },  // half;
+  { 9411, 7, 0, 0x210b },  // hamilt;
+  { 9418, 7, 0, 0x044a },  // hardcy;
+  { 9425, 5, 0, 0x2194 },  // harr;
+  { 9430, 8, 0, 0x2948 },  // harrcir;
+  { 9438, 6, 0, 0x21ad },  // harrw;
+  { 9444, 5, 0, 0x210f },  // hbar;
+  { 9449, 6, 0, 0x0125 },  // hcirc;
+  { 9455, 7, 0, 0x2665 },  // hearts;
+  { 9462, 10, 0, 0x2665 },  // heartsuit;
+  { 9472, 7, 0, 0x2026 },  // hellip;
+  { 9479, 7, 0, 0x22b9 },  // hercon;
+  { 9486, 4, 0, 0x1d525 },  // hfr;
+  { 9490, 9, 0, 0x2925 },  // hksearow;
+  { 9499, 9, 0, 0x2926 },  // hkswarow;
+  { 9508, 6, 0, 0x21ff },  // hoarr;
+  { 9514, 7, 0, 0x223b },  // homtht;
+  { 9521, 14, 0, 0x21a9 },  // hookleftarrow;
+  { 9535, 15, 0, 0x21aa },  // hookrightarrow;
+  { 9550, 5, 0, 0x1d559 },  // hopf;
+  { 9555, 7, 0, 0x2015 },  // horbar;
+  { 9562, 5, 0, 0x1d4bd },  // hscr;
+  { 9567, 7, 0, 0x210f },  // hslash;
+  { 9574, 7, 0, 0x0127 },  // hstrok;
+  { 9581, 7, 0, 0x2043 },  // hybull;
+  { 9588, 7, 0, 0x2010 },  // hyphen;
+  { 9595, 6, 0, 0x00ed },  // iacute
+  { 9601, 7, 0, 0x00ed },  // iacute;
+  { 9608, 3, 0, 0x2063 },  // ic;
+  { 9611, 5, 0, 0x00ee },  // icirc
+  { 9616, 6, 0, 0x00ee },  // icirc;
+  { 9622, 4, 0, 0x0438 },  // icy;
+  { 9626, 5, 0, 0x0435 },  // iecy;
+  { 9631, 5, 0, 0x00a1 },  // iexcl
+  { 9636, 6, 0, 0x00a1 },  // iexcl;
+  { 9642, 4, 0, 0x21d4 },  // iff;
+  { 9646, 4, 0, 0x1d526 },  // ifr;
+  { 9650, 6, 0, 0x00ec },  // igrave
+  { 9656, 7, 0, 0x00ec },  // igrave;
+  { 9663, 3, 0, 0x2148 },  // ii;
+  { 9666, 7, 0, 0x2a0c },  // iiiint;
+  { 9673, 6, 0, 0x222d },  // iiint;
+  { 9679, 7, 0, 0x29dc },  // iinfin;
+  { 9686, 6, 0, 0x2129 },  // iiota;
+  { 9692, 6, 0, 0x0133 },  // ijlig;
+  { 9698, 6, 0, 0x012b },  // imacr;
+  { 9704, 6, 0, 0x2111 },  // image;
+  { 9710, 9, 0, 0x2110 },  // imagline;
+  { 9719, 9, 0, 0x2111 },  // imagpart;
+  { 9728, 6, 0, 0x0131 },  // imath;
+  { 9734, 5, 0, 0x22b7 },  // imof;
+  { 9739, 6, 0, 0x01b5 },  // imped;
+  { 9745, 3, 0, 0x2208 },  // in;
+  { 9748, 7, 0, 0x2105 },  // incare;
+  { 9755, 6, 0, 0x221e },  // infin;
+  { 9761, 9, 0, 0x29dd },  // infintie;
+  { 9770, 7, 0, 0x0131 },  // inodot;
+  { 9777, 4, 0, 0x222b },  // int;
+  { 9781, 7, 0, 0x22ba },  // intcal;
+  { 9788, 9, 0, 0x2124 },  // integers;
+  { 9797, 9, 0, 0x22ba },  // intercal;
+  { 9806, 9, 0, 0x2a17 },  // intlarhk;
+  { 9815, 8, 0, 0x2a3c },  // intprod;
+  { 9823, 5, 0, 0x0451 },  // iocy;
+  { 9828, 6, 0, 0x012f },  // iogon;
+  { 9834, 5, 0, 0x1d55a },  // iopf;
+  { 9839, 5, 0, 0x03b9 },  // iota;
+  { 9844, 6, 0, 0x2a3c },  // iprod;
+  { 9850, 6, 0, 0x00bf },  // iquest
+  { 9856, 7, 0, 0x00bf },  // iquest;
+  { 9863, 5, 0, 0x1d4be },  // iscr;
+  { 9868, 5, 0, 0x2208 },  // isin;
+  { 9873, 6, 0, 0x22f9 },  // isinE;
+  { 9879, 8, 0, 0x22f5 },  // isindot;
+  { 9887, 6, 0, 0x22f4 },  // isins;
+  { 9893, 7, 0, 0x22f3 },  // isinsv;
+  { 9900, 6, 0, 0x2208 },  // isinv;
+  { 9906, 3, 0, 0x2062 },  // it;
+  { 9909, 7, 0, 0x0129 },  // itilde;
+  { 9916, 6, 0, 0x0456 },  // iukcy;
+  { 9922, 4, 0, 0x00ef },  // iuml
+  { 9926, 5, 0, 0x00ef },  // iuml;
+  { 9931, 6, 0, 0x0135 },  // jcirc;
+  { 9937, 4, 0, 0x0439 },  // jcy;
+  { 9941, 4, 0, 0x1d527 },  // jfr;
+  { 9945, 6, 0, 0x0237 },  // jmath;
+  { 9951, 5, 0, 0x1d55b },  // jopf;
+  { 9956, 5, 0, 0x1d4bf },  // jscr;
+  { 9961, 7, 0, 0x0458 },  // jsercy;
+  { 9968, 6, 0, 0x0454 },  // jukcy;
+  { 9974, 6, 0, 0x03ba },  // kappa;
+  { 9980, 7, 0, 0x03f0 },  // kappav;
+  { 9987, 7, 0, 0x0137 },  // kcedil;
+  { 9994, 4, 0, 0x043a },  // kcy;
+  { 9998, 4, 0, 0x1d528 },  // kfr;
+  { 10002, 7, 0, 0x0138 },  // kgreen;
+  { 10009, 5, 0, 0x0445 },  // khcy;
+  { 10014, 5, 0, 0x045c },  // kjcy;
+  { 10019, 5, 0, 0x1d55c },  // kopf;
+  { 10024, 5, 0, 0x1d4c0 },  // kscr;
+  { 10029, 6, 0, 0x21da },  // lAarr;
+  { 10035, 5, 0, 0x21d0 },  // lArr;
+  { 10040, 7, 0, 0x291b },  // lAtail;
+  { 10047, 6, 0, 0x290e },  // lBarr;
+  { 10053, 3, 0, 0x2266 },  // lE;
+  { 10056, 4, 0, 0x2a8b },  // lEg;
+  { 10060, 5, 0, 0x2962 },  // lHar;
+  { 10065, 7, 0, 0x013a },  // lacute;
+  { 10072, 9, 0, 0x29b4 },  // laemptyv;
+  { 10081, 7, 0, 0x2112 },  // lagran;
+  { 10088, 7, 0, 0x03bb },  // lambda;
+  { 10095, 5, 0, 0x27e8 },  // lang;
+  { 10100, 6, 0, 0x2991 },  // langd;
+  { 10106, 7, 0, 0x27e8 },  // langle;
+  { 10113, 4, 0, 0x2a85 },  // lap;
+  { 10117, 5, 0, 0x00ab },  // laquo
+  { 10122, 6, 0, 0x00ab },  // laquo;
+  { 10128, 5, 0, 0x2190 },  // larr;
+  { 10133, 6, 0, 0x21e4 },  // larrb;
+  { 10139, 8, 0, 0x291f },  // larrbfs;
+  { 10147, 7, 0, 0x291d },  // larrfs;
+  { 10154, 7, 0, 0x21a9 },  // larrhk;
+  { 10161, 7, 0, 0x21ab },  // larrlp;
+  { 10168, 7, 0, 0x2939 },  // larrpl;
+  { 10175, 8, 0, 0x2973 },  // larrsim;
+  { 10183, 7, 0, 0x21a2 },  // larrtl;
+  { 10190, 4, 0, 0x2aab },  // lat;
+  { 10194, 7, 0, 0x2919 },  // latail;
+  { 10201, 5, 0, 0x2aad },  // late;
+  { 10206, 6, 8, 0x2aad },  // lates;
+  { 10212, 6, 0, 0x290c },  // lbarr;
+  { 10218, 6, 0, 0x2772 },  // lbbrk;
+  { 10224, 7, 0, 0x007b },  // lbrace;
+  { 10231, 7, 0, 0x005b },  // lbrack;
+  { 10238, 6, 0, 0x298b },  // lbrke;
+  { 10244, 8, 0, 0x298f },  // lbrksld;
+  { 10252, 8, 0, 0x298d },  // lbrkslu;
+  { 10260, 7, 0, 0x013e },  // lcaron;
+  { 10267, 7, 0, 0x013c },  // lcedil;
+  { 10274, 6, 0, 0x2308 },  // lceil;
+  { 10280, 5, 0, 0x007b },  // lcub;
+  { 10285, 4, 0, 0x043b },  // lcy;
+  { 10289, 5, 0, 0x2936 },  // ldca;
+  { 10294, 6, 0, 0x201c },  // ldquo;
+  { 10300, 7, 0, 0x201e },  // ldquor;
+  { 10307, 8, 0, 0x2967 },  // ldrdhar;
+  { 10315, 9, 0, 0x294b },  // ldrushar;
+  { 10324, 5, 0, 0x21b2 },  // ldsh;
+  { 10329, 3, 0, 0x2264 },  // le;
+  { 10332, 10, 0, 0x2190 },  // leftarrow;
+  { 10342, 14, 0, 0x21a2 },  // leftarrowtail;
+  { 10356, 16, 0, 0x21bd },  // leftharpoondown;
+  { 10372, 14, 0, 0x21bc },  // leftharpoonup;
+  { 10386, 15, 0, 0x21c7 },  // leftleftarrows;
+  { 10401, 15, 0, 0x2194 },  // leftrightarrow;
+  { 10416, 16, 0, 0x21c6 },  // leftrightarrows;
+  { 10432, 18, 0, 0x21cb },  // leftrightharpoons;
+  { 10450, 20, 0, 0x21ad },  // leftrightsquigarrow;
+  { 10470, 15, 0, 0x22cb },  // leftthreetimes;
+  { 10485, 4, 0, 0x22da },  // leg;
+  { 10489, 4, 0, 0x2264 },  // leq;
+  { 10493, 5, 0, 0x2266 },  // leqq;
+  { 10498, 9, 0, 0x2a7d },  // leqslant;
+  { 10507, 4, 0, 0x2a7d },  // les;
+  { 10511, 6, 0, 0x2aa8 },  // lescc;
+  { 10517, 7, 0, 0x2a7f },  // lesdot;
+  { 10524, 8, 0, 0x2a81 },  // lesdoto;
+  { 10532, 9, 0, 0x2a83 },  // lesdotor;
+  { 10541, 5, 8, 0x22da },  // lesg;
+  { 10546, 7, 0, 0x2a93 },  // lesges;
+  { 10553, 11, 0, 0x2a85 },  // lessapprox;
+  { 10564, 8, 0, 0x22d6 },  // lessdot;
+  { 10572, 10, 0, 0x22da },  // lesseqgtr;
+  { 10582, 11, 0, 0x2a8b },  // lesseqqgtr;
+  { 10593, 8, 0, 0x2276 },  // lessgtr;
+  { 10601, 8, 0, 0x2272 },  // lesssim;
+  { 10609, 7, 0, 0x297c },  // lfisht;
+  { 10616, 7, 0, 0x230a },  // lfloor;
+  { 10623, 4, 0, 0x1d529 },  // lfr;
+  { 10627, 3, 0, 0x2276 },  // lg;
+  { 10630, 4, 0, 0x2a91 },  // lgE;
+  { 10634, 6, 0, 0x21bd },  // lhard;
+  { 10640, 6, 0, 0x21bc },  // lharu;
+  { 10646, 7, 0, 0x296a },  // lharul;
+  { 10653, 6, 0, 0x2584 },  // lhblk;
+  { 10659, 5, 0, 0x0459 },  // ljcy;
+  { 10664, 3, 0, 0x226a },  // ll;
+  { 10667, 6, 0, 0x21c7 },  // llarr;
+  { 10673, 9, 0, 0x231e },  // llcorner;
+  { 10682, 7, 0, 0x296b },  // llhard;
+  { 10689, 6, 0, 0x25fa },  // lltri;
+  { 10695, 7, 0, 0x0140 },  // lmidot;
+  { 10702, 7, 0, 0x23b0 },  // lmoust;
+  { 10709, 11, 0, 0x23b0 },  // lmoustache;
+  { 10720, 4, 0, 0x2268 },  // lnE;
+  { 10724, 5, 0, 0x2a89 },  // lnap;
+  { 10729, 9, 0, 0x2a89 },  // lnapprox;
+  { 10738, 4, 0, 0x2a87 },  // lne;
+  { 10742, 5, 0, 0x2a87 },  // lneq;
+  { 10747, 6, 0, 0x2268 },  // lneqq;
+  { 10753, 6, 0, 0x22e6 },  // lnsim;
+  { 10759, 6, 0, 0x27ec },  // loang;
+  { 10765, 6, 0, 0x21fd },  // loarr;
+  { 10771, 6, 0, 0x27e6 },  // lobrk;
+  { 10777, 14, 0, 0x27f5 },  // longleftarrow;
+  { 10791, 19, 0, 0x27f7 },  // longleftrightarrow;
+  { 10810, 11, 0, 0x27fc },  // longmapsto;
+  { 10821, 15, 0, 0x27f6 },  // longrightarrow;
+  { 10836, 14, 0, 0x21ab },  // looparrowleft;
+  { 10850, 15, 0, 0x21ac },  // looparrowright;
+  { 10865, 6, 0, 0x2985 },  // lopar;
+  { 10871, 5, 0, 0x1d55d },  // lopf;
+  { 10876, 7, 0, 0x2a2d },  // loplus;
+  { 10883, 8, 0, 0x2a34 },  // lotimes;
+  { 10891, 7, 0, 0x2217 },  // lowast;
+  { 10898, 7, 0, 0x005f },  // lowbar;
+  { 10905, 4, 0, 0x25ca },  // loz;
+  { 10909, 8, 0, 0x25ca },  // lozenge;
+  { 10917, 5, 0, 0x29eb },  // lozf;
+  { 10922, 5, 0, 0x0028 },  // lpar;
+  { 10927, 7, 0, 0x2993 },  // lparlt;
+  { 10934, 6, 0, 0x21c6 },  // lrarr;
+  { 10940, 9, 0, 0x231f },  // lrcorner;
+  { 10949, 6, 0, 0x21cb },  // lrhar;
+  { 10955, 7, 0, 0x296d },  // lrhard;
+  { 10962, 4, 0, 0x200e },  // lrm;
+  { 10966, 6, 0, 0x22bf },  // lrtri;
+  { 10972, 7, 0, 0x2039 },  // lsaquo;
+  { 10979, 5, 0, 0x1d4c1 },  // lscr;
+  { 10984, 4, 0, 0x21b0 },  // lsh;
+  { 10988, 5, 0, 0x2272 },  // lsim;
+  { 10993, 6, 0, 0x2a8d },  // lsime;
+  { 10999, 6, 0, 0x2a8f },  // lsimg;
+  { 11005, 5, 0, 0x005b },  // lsqb;
+  { 11010, 6, 0, 0x2018 },  // lsquo;
+  { 11016, 7, 0, 0x201a },  // lsquor;
+  { 11023, 7, 0, 0x0142 },  // lstrok;
+  { 11030, 2, 0, 0x003c },  // lt
+  { 11032, 3, 0, 0x003c },  // lt;
+  { 11035, 5, 0, 0x2aa6 },  // ltcc;
+  { 11040, 6, 0, 0x2a79 },  // ltcir;
+  { 11046, 6, 0, 0x22d6 },  // ltdot;
+  { 11052, 7, 0, 0x22cb },  // lthree;
+  { 11059, 7, 0, 0x22c9 },  // ltimes;
+  { 11066, 7, 0, 0x2976 },  // ltlarr;
+  { 11073, 8, 0, 0x2a7b },  // ltquest;
+  { 11081, 7, 0, 0x2996 },  // ltrPar;
+  { 11088, 5, 0, 0x25c3 },  // ltri;
+  { 11093, 6, 0, 0x22b4 },  // ltrie;
+  { 11099, 6, 0, 0x25c2 },  // ltrif;
+  { 11105, 9, 0, 0x294a },  // lurdshar;
+  { 11114, 8, 0, 0x2966 },  // luruhar;
+  { 11122, 10, 8, 0x2268 },  // lvertneqq;
+  { 11132, 5, 8, 0x2268 },  // lvnE;
+  { 11137, 6, 0, 0x223a },  // mDDot;
+  { 11143, 4, 0, 0x00af },  // macr
+  { 11147, 5, 0, 0x00af },  // macr;
+  { 11152, 5, 0, 0x2642 },  // male;
+  { 11157, 5, 0, 0x2720 },  // malt;
+  { 11162, 8, 0, 0x2720 },  // maltese;
+  { 11170, 4, 0, 0x21a6 },  // map;
+  { 11174, 7, 0, 0x21a6 },  // mapsto;
+  { 11181, 11, 0, 0x21a7 },  // mapstodown;
+  { 11192, 11, 0, 0x21a4 },  // mapstoleft;
+  { 11203, 9, 0, 0x21a5 },  // mapstoup;
+  { 11212, 7, 0, 0x25ae },  // marker;
+  { 11219, 7, 0, 0x2a29 },  // mcomma;
+  { 11226, 4, 0, 0x043c },  // mcy;
+  { 11230, 6, 0, 0x2014 },  // mdash;
+  { 11236, 14, 0, 0x2221 },  // measuredangle;
+  { 11250, 4, 0, 0x1d52a },  // mfr;
+  { 11254, 4, 0, 0x2127 },  // mho;
+  { 11258, 5, 0, 0x00b5 },  // micro
+  { 11263, 6, 0, 0x00b5 },  // micro;
+  { 11269, 4, 0, 0x2223 },  // mid;
+  { 11273, 7, 0, 0x002a },  // midast;
+  { 11280, 7, 0, 0x2af0 },  // midcir;
+  { 11287, 6, 0, 0x00b7 },  // middot
+  { 11293, 7, 0, 0x00b7 },  // middot;
+  { 11300, 6, 0, 0x2212 },  // minus;
+  { 11306, 7, 0, 0x229f },  // minusb;
+  { 11313, 7, 0, 0x2238 },  // minusd;
+  { 11320, 8, 0, 0x2a2a },  // minusdu;
+  { 11328, 5, 0, 0x2adb },  // mlcp;
+  { 11333, 5, 0, 0x2026 },  // mldr;
+  { 11338, 7, 0, 0x2213 },  // mnplus;
+  { 11345, 7, 0, 0x22a7 },  // models;
+  { 11352, 5, 0, 0x1d55e },  // mopf;
+  { 11357, 3, 0, 0x2213 },  // mp;
+  { 11360, 5, 0, 0x1d4c2 },  // mscr;
+  { 11365, 7, 0, 0x223e },  // mstpos;
+  { 11372, 3, 0, 0x03bc },  // mu;
+  { 11375, 9, 0, 0x22b8 },  // multimap;
+  { 11384, 6, 0, 0x22b8 },  // mumap;
+  { 11390, 4, 4, 0x22d9 },  // nGg;
+  { 11394, 4, 6, 0x226b },  // nGt;
+  { 11398, 5, 4, 0x226b },  // nGtv;
+  { 11403, 11, 0, 0x21cd },  // nLeftarrow;
+  { 11414, 16, 0, 0x21ce },  // nLeftrightarrow;
+  { 11430, 4, 4, 0x22d8 },  // nLl;
+  { 11434, 4, 6, 0x226a },  // nLt;
+  { 11438, 5, 4, 0x226a },  // nLtv;
+  { 11443, 12, 0, 0x21cf },  // nRightarrow;
+  { 11455, 7, 0, 0x22af },  // nVDash;
+  { 11462, 7, 0, 0x22ae },  // nVdash;
+  { 11469, 6, 0, 0x2207 },  // nabla;
+  { 11475, 7, 0, 0x0144 },  // nacute;
+  { 11482, 5, 6, 0x2220 },  // nang;
+  { 11487, 4, 0, 0x2249 },  // nap;
+  { 11491, 5, 4, 0x2a70 },  // napE;
+  { 11496, 6, 4, 0x224b },  // napid;
+  { 11502, 6, 0, 0x0149 },  // napos;
+  { 11508, 8, 0, 0x2249 },  // napprox;
+  { 11516, 6, 0, 0x266e },  // natur;
+  { 11522, 8, 0, 0x266e },  // natural;
+  { 11530, 9, 0, 0x2115 },  // naturals;
+  { 11539, 4, 0, 0x00a0 },  // nbsp
+  { 11543, 5, 0, 0x00a0 },  // nbsp;
+  { 11548, 6, 4, 0x224e },  // nbump;
+  { 11554, 7, 4, 0x224f },  // nbumpe;
+  { 11561, 5, 0, 0x2a43 },  // ncap;
+  { 11566, 7, 0, 0x0148 },  // ncaron;
+  { 11573, 7, 0, 0x0146 },  // ncedil;
+  { 11580, 6, 0, 0x2247 },  // ncong;
+  { 11586, 9, 4, 0x2a6d },  // ncongdot;
+  { 11595, 5, 0, 0x2a42 },  // ncup;
+  { 11600, 4, 0, 0x043d },  // ncy;
+  { 11604, 6, 0, 0x2013 },  // ndash;
+  { 11610, 3, 0, 0x2260 },  // ne;
+  { 11613, 6, 0, 0x21d7 },  // neArr;
+  { 11619, 7, 0, 0x2924 },  // nearhk;
+  { 11626, 6, 0, 0x2197 },  // nearr;
+  { 11632, 8, 0, 0x2197 },  // nearrow;
+  { 11640, 6, 4, 0x2250 },  // nedot;
+  { 11646, 7, 0, 0x2262 },  // nequiv;
+  { 11653, 7, 0, 0x2928 },  // nesear;
+  { 11660, 6, 4, 0x2242 },  // nesim;
+  { 11666, 7, 0, 0x2204 },  // nexist;
+  { 11673, 8, 0, 0x2204 },  // nexists;
+  { 11681, 4, 0, 0x1d52b },  // nfr;
+  { 11685, 4, 4, 0x2267 },  // ngE;
+  { 11689, 4, 0, 0x2271 },  // nge;
+  { 11693, 5, 0, 0x2271 },  // ngeq;
+  { 11698, 6, 4, 0x2267 },  // ngeqq;
+  { 11704, 10, 4, 0x2a7e },  // ngeqslant;
+  { 11714, 5, 4, 0x2a7e },  // nges;
+  { 11719, 6, 0, 0x2275 },  // ngsim;
+  { 11725, 4, 0, 0x226f },  // ngt;
+  { 11729, 5, 0, 0x226f },  // ngtr;
+  { 11734, 6, 0, 0x21ce },  // nhArr;
+  { 11740, 6, 0, 0x21ae },  // nharr;
+  { 11746, 6, 0, 0x2af2 },  // nhpar;
+  { 11752, 3, 0, 0x220b },  // ni;
+  { 11755, 4, 0, 0x22fc },  // nis;
+  { 11759, 5, 0, 0x22fa },  // nisd;
+  { 11764, 4, 0, 0x220b },  // niv;
+  { 11768, 5, 0, 0x045a },  // njcy;
+  { 11773, 6, 0, 0x21cd },  // nlArr;
+  { 11779, 4, 4, 0x2266 },  // nlE;
+  { 11783, 6, 0, 0x219a },  // nlarr;
+  { 11789, 5, 0, 0x2025 },  // nldr;
+  { 11794, 4, 0, 0x2270 },  // nle;
+  { 11798, 11, 0, 0x219a },  // nleftarrow;
+  { 11809, 16, 0, 0x21ae },  // nleftrightarrow;
+  { 11825, 5, 0, 0x2270 },  // nleq;
+  { 11830, 6, 4, 0x2266 },  // nleqq;
+  { 11836, 10, 4, 0x2a7d },  // nleqslant;
+  { 11846, 5, 4, 0x2a7d },  // nles;
+  { 11851, 6, 0, 0x226e },  // nless;
+  { 11857, 6, 0, 0x2274 },  // nlsim;
+  { 11863, 4, 0, 0x226e },  // nlt;
+  { 11867, 6, 0, 0x22ea },  // nltri;
+  { 11873, 7, 0, 0x22ec },  // nltrie;
+  { 11880, 5, 0, 0x2224 },  // nmid;
+  { 11885, 5, 0, 0x1d55f },  // nopf;
+  { 11890, 3, 0, 0x00ac },  // not
+  { 11893, 4, 0, 0x00ac },  // not;
+  { 11897, 6, 0, 0x2209 },  // notin;
+  { 11903, 7, 4, 0x22f9 },  // notinE;
+  { 11910, 9, 4, 0x22f5 },  // notindot;
+  { 11919, 8, 0, 0x2209 },  // notinva;
+  { 11927, 8, 0, 0x22f7 },  // notinvb;
+  { 11935, 8, 0, 0x22f6 },  // notinvc;
+  { 11943, 6, 0, 0x220c },  // notni;
+  { 11949, 8, 0, 0x220c },  // notniva;
+  { 11957, 8, 0, 0x22fe },  // notnivb;
+  { 11965, 8, 0, 0x22fd },  // notnivc;
+  { 11973, 5, 0, 0x2226 },  // npar;
+  { 11978, 10, 0, 0x2226 },  // nparallel;
+  { 11988, 7, 7, 0x2afd },  // nparsl;
+  { 11995, 6, 4, 0x2202 },  // npart;
+  { 12001, 8, 0, 0x2a14 },  // npolint;
+  { 12009, 4, 0, 0x2280 },  // npr;
+  { 12013, 7, 0, 0x22e0 },  // nprcue;
+  { 12020, 5, 4, 0x2aaf },  // npre;
+  { 12025, 6, 0, 0x2280 },  // nprec;
+  { 12031, 8, 4, 0x2aaf },  // npreceq;
+  { 12039, 6, 0, 0x21cf },  // nrArr;
+  { 12045, 6, 0, 0x219b },  // nrarr;
+  { 12051, 7, 4, 0x2933 },  // nrarrc;
+  { 12058, 7, 4, 0x219d },  // nrarrw;
+  { 12065, 12, 0, 0x219b },  // nrightarrow;
+  { 12077, 6, 0, 0x22eb },  // nrtri;
+  { 12083, 7, 0, 0x22ed },  // nrtrie;
+  { 12090, 4, 0, 0x2281 },  // nsc;
+  { 12094, 7, 0, 0x22e1 },  // nsccue;
+  { 12101, 5, 4, 0x2ab0 },  // nsce;
+  { 12106, 5, 0, 0x1d4c3 },  // nscr;
+  { 12111, 10, 0, 0x2224 },  // nshortmid;
+  { 12121, 15, 0, 0x2226 },  // nshortparallel;
+  { 12136, 5, 0, 0x2241 },  // nsim;
+  { 12141, 6, 0, 0x2244 },  // nsime;
+  { 12147, 7, 0, 0x2244 },  // nsimeq;
+  { 12154, 6, 0, 0x2224 },  // nsmid;
+  { 12160, 6, 0, 0x2226 },  // nspar;
+  { 12166, 8, 0, 0x22e2 },  // nsqsube;
+  { 12174, 8, 0, 0x22e3 },  // nsqsupe;
+  { 12182, 5, 0, 0x2284 },  // nsub;
+  { 12187, 6, 4, 0x2ac5 },  // nsubE;
+  { 12193, 6, 0, 0x2288 },  // nsube;
+  { 12199, 8, 6, 0x2282 },  // nsubset;
+  { 12207, 10, 0, 0x2288 },  // nsubseteq;
+  { 12217, 11, 4, 0x2ac5 },  // nsubseteqq;
+  { 12228, 6, 0, 0x2281 },  // nsucc;
+  { 12234, 8, 4, 0x2ab0 },  // nsucceq;
+  { 12242, 5, 0, 0x2285 },  // nsup;
+  { 12247, 6, 4, 0x2ac6 },  // nsupE;
+  { 12253, 6, 0, 0x2289 },  // nsupe;
+  { 12259, 8, 6, 0x2283 },  // nsupset;
+  { 12267, 10, 0, 0x2289 },  // nsupseteq;
+  { 12277, 11, 4, 0x2ac6 },  // nsupseteqq;
+  { 12288, 5, 0, 0x2279 },  // ntgl;
+  { 12293, 6, 0, 0x00f1 },  // ntilde
+  { 12299, 7, 0, 0x00f1 },  // ntilde;
+  { 12306, 5, 0, 0x2278 },  // ntlg;
+  { 12311, 14, 0, 0x22ea },  // ntriangleleft;
+  { 12325, 16, 0, 0x22ec },  // ntrianglelefteq;
+  { 12341, 15, 0, 0x22eb },  // ntriangleright;
+  { 12356, 17, 0, 0x22ed },  // ntrianglerighteq;
+  { 12373, 3, 0, 0x03bd },  // nu;
+  { 12376, 4, 0, 0x0023 },  // num;
+  { 12380, 7, 0, 0x2116 },  // numero;
+  { 12387, 6, 0, 0x2007 },  // numsp;
+  { 12393, 7, 0, 0x22ad },  // nvDash;
+  { 12400, 7, 0, 0x2904 },  // nvHarr;
+  { 12407, 5, 6, 0x224d },  // nvap;
+  { 12412, 7, 0, 0x22ac },  // nvdash;
+  { 12419, 5, 6, 0x2265 },  // nvge;
+  { 12424, 5, 6, 0x003e },  // nvgt;
+  { 12429, 8, 0, 0x29de },  // nvinfin;
+  { 12437, 7, 0, 0x2902 },  // nvlArr;
+  { 12444, 5, 6, 0x2264 },  // nvle;
+  { 12449, 5, 6, 0x003c },  // nvlt;
+  { 12454, 8, 6, 0x22b4 },  // nvltrie;
+  { 12462, 7, 0, 0x2903 },  // nvrArr;
+  { 12469, 8, 6, 0x22b5 },  // nvrtrie;
+  { 12477, 6, 6, 0x223c },  // nvsim;
+  { 12483, 6, 0, 0x21d6 },  // nwArr;
+  { 12489, 7, 0, 0x2923 },  // nwarhk;
+  { 12496, 6, 0, 0x2196 },  // nwarr;
+  { 12502, 8, 0, 0x2196 },  // nwarrow;
+  { 12510, 7, 0, 0x2927 },  // nwnear;
+  { 12517, 3, 0, 0x24c8 },  // oS;
+  { 12520, 6, 0, 0x00f3 },  // oacute
+  { 12526, 7, 0, 0x00f3 },  // oacute;
+  { 12533, 5, 0, 0x229b },  // oast;
+  { 12538, 5, 0, 0x229a },  // ocir;
+  { 12543, 5, 0, 0x00f4 },  // ocirc
+  { 12548, 6, 0, 0x00f4 },  // ocirc;
+  { 12554, 4, 0, 0x043e },  // ocy;
+  { 12558, 6, 0, 0x229d },  // odash;
+  { 12564, 7, 0, 0x0151 },  // odblac;
+  { 12571, 5, 0, 0x2a38 },  // odiv;
+  { 12576, 5, 0, 0x2299 },  // odot;
+  { 12581, 7, 0, 0x29bc },  // odsold;
+  { 12588, 6, 0, 0x0153 },  // oelig;
+  { 12594, 6, 0, 0x29bf },  // ofcir;
+  { 12600, 4, 0, 0x1d52c },  // ofr;
+  { 12604, 5, 0, 0x02db },  // ogon;
+  { 12609, 6, 0, 0x00f2 },  // ograve
+  { 12615, 7, 0, 0x00f2 },  // ograve;
+  { 12622, 4, 0, 0x29c1 },  // ogt;
+  { 12626, 6, 0, 0x29b5 },  // ohbar;
+  { 12632, 4, 0, 0x03a9 },  // ohm;
+  { 12636, 5, 0, 0x222e },  // oint;
+  { 12641, 6, 0, 0x21ba },  // olarr;
+  { 12647, 6, 0, 0x29be },  // olcir;
+  { 12653, 8, 0, 0x29bb },  // olcross;
+  { 12661, 6, 0, 0x203e },  // oline;
+  { 12667, 4, 0, 0x29c0 },  // olt;
+  { 12671, 6, 0, 0x014d },  // omacr;
+  { 12677, 6, 0, 0x03c9 },  // omega;
+  { 12683, 8, 0, 0x03bf },  // omicron;
+  { 12691, 5, 0, 0x29b6 },  // omid;
+  { 12696, 7, 0, 0x2296 },  // ominus;
+  { 12703, 5, 0, 0x1d560 },  // oopf;
+  { 12708, 5, 0, 0x29b7 },  // opar;
+  { 12713, 6, 0, 0x29b9 },  // operp;
+  { 12719, 6, 0, 0x2295 },  // oplus;
+  { 12725, 3, 0, 0x2228 },  // or;
+  { 12728, 6, 0, 0x21bb },  // orarr;
+  { 12734, 4, 0, 0x2a5d },  // ord;
+  { 12738, 6, 0, 0x2134 },  // order;
+  { 12744, 8, 0, 0x2134 },  // orderof;
+  { 12752, 4, 0, 0x00aa },  // ordf
+  { 12756, 5, 0, 0x00aa },  // ordf;
+  { 12761, 4, 0, 0x00ba },  // ordm
+  { 12765, 5, 0, 0x00ba },  // ordm;
+  { 12770, 7, 0, 0x22b6 },  // origof;
+  { 12777, 5, 0, 0x2a56 },  // oror;
+  { 12782, 8, 0, 0x2a57 },  // orslope;
+  { 12790, 4, 0, 0x2a5b },  // orv;
+  { 12794, 5, 0, 0x2134 },  // oscr;
+  { 12799, 6, 0, 0x00f8 },  // oslash
+  { 12805, 7, 0, 0x00f8 },  // oslash;
+  { 12812, 5, 0, 0x2298 },  // osol;
+  { 12817, 6, 0, 0x00f5 },  // otilde
+  { 12823, 7, 0, 0x00f5 },  // otilde;
+  { 12830, 7, 0, 0x2297 },  // otimes;
+  { 12837, 9, 0, 0x2a36 },  // otimesas;
+  { 12846, 4, 0, 0x00f6 },  // ouml
+  { 12850, 5, 0, 0x00f6 },  // ouml;
+  { 12855, 6, 0, 0x233d },  // ovbar;
+  { 12861, 4, 0, 0x2225 },  // par;
+  { 12865, 4, 0, 0x00b6 },  // para
+  { 12869, 5, 0, 0x00b6 },  // para;
+  { 12874, 9, 0, 0x2225 },  // parallel;
+  { 12883, 7, 0, 0x2af3 },  // parsim;
+  { 12890, 6, 0, 0x2afd },  // parsl;
+  { 12896, 5, 0, 0x2202 },  // part;
+  { 12901, 4, 0, 0x043f },  // pcy;
+  { 12905, 7, 0, 0x0025 },  // percnt;
+  { 12912, 7, 0, 0x002e },  // period;
+  { 12919, 7, 0, 0x2030 },  // permil;
+  { 12926, 5, 0, 0x22a5 },  // perp;
+  { 12931, 8, 0, 0x2031 },  // pertenk;
+  { 12939, 4, 0, 0x1d52d },  // pfr;
+  { 12943, 4, 0, 0x03c6 },  // phi;
+  { 12947, 5, 0, 0x03d5 },  // phiv;
+  { 12952, 7, 0, 0x2133 },  // phmmat;
+  { 12959, 6, 0, 0x260e },  // phone;
+  { 12965, 3, 0, 0x03c0 },  // pi;
+  { 12968, 10, 0, 0x22d4 },  // pitchfork;
+  { 12978, 4, 0, 0x03d6 },  // piv;
+  { 12982, 7, 0, 0x210f },  // planck;
+  { 12989, 8, 0, 0x210e },  // planckh;
+  { 12997, 7, 0, 0x210f },  // plankv;
+  { 13004, 5, 0, 0x002b },  // plus;
+  { 13009, 9, 0, 0x2a23 },  // plusacir;
+  { 13018, 6, 0, 0x229e },  // plusb;
+  { 13024, 8, 0, 0x2a22 },  // pluscir;
+  { 13032, 7, 0, 0x2214 },  // plusdo;
+  { 13039, 7, 0, 0x2a25 },  // plusdu;
+  { 13046, 6, 0, 0x2a72 },  // pluse;
+  { 13052, 6, 0, 0x00b1 },  // plusmn
+  { 13058, 7, 0, 0x00b1 },  // plusmn;
+  { 13065, 8, 0, 0x2a26 },  // plussim;
+  { 13073, 8, 0, 0x2a27 },  // plustwo;
+  { 13081, 3, 0, 0x00b1 },  // pm;
+  { 13084, 9, 0, 0x2a15 },  // pointint;
+  { 13093, 5, 0, 0x1d561 },  // popf;
+  { 13098, 5, 0, 0x00a3 },  // pound
+  { 13103, 6, 0, 0x00a3 },  // pound;
+  { 13109, 3, 0, 0x227a },  // pr;
+  { 13112, 4, 0, 0x2ab3 },  // prE;
+  { 13116, 5, 0, 0x2ab7 },  // prap;
+  { 13121, 6, 0, 0x227c },  // prcue;
+  { 13127, 4, 0, 0x2aaf },  // pre;
+  { 13131, 5, 0, 0x227a },  // prec;
+  { 13136, 11, 0, 0x2ab7 },  // precapprox;
+  { 13147, 12, 0, 0x227c },  // preccurlyeq;
+  { 13159, 7, 0, 0x2aaf },  // preceq;
+  { 13166, 12, 0, 0x2ab9 },  // precnapprox;
+  { 13178, 9, 0, 0x2ab5 },  // precneqq;
+  { 13187, 9, 0, 0x22e8 },  // precnsim;
+  { 13196, 8, 0, 0x227e },  // precsim;
+  { 13204, 6, 0, 0x2032 },  // prime;
+  { 13210, 7, 0, 0x2119 },  // primes;
+  { 13217, 5, 0, 0x2ab5 },  // prnE;
+  { 13222, 6, 0, 0x2ab9 },  // prnap;
+  { 13228, 7, 0, 0x22e8 },  // prnsim;
+  { 13235, 5, 0, 0x220f },  // prod;
+  { 13240, 9, 0, 0x232e },  // profalar;
+  { 13249, 9, 0, 0x2312 },  // profline;
+  { 13258, 9, 0, 0x2313 },  // profsurf;
+  { 13267, 5, 0, 0x221d },  // prop;
+  { 13272, 7, 0, 0x221d },  // propto;
+  { 13279, 6, 0, 0x227e },  // prsim;
+  { 13285, 7, 0, 0x22b0 },  // prurel;
+  { 13292, 5, 0, 0x1d4c5 },  // pscr;
+  { 13297, 4, 0, 0x03c8 },  // psi;
+  { 13301, 7, 0, 0x2008 },  // puncsp;
+  { 13308, 4, 0, 0x1d52e },  // qfr;
+  { 13312, 5, 0, 0x2a0c },  // qint;
+  { 13317, 5, 0, 0x1d562 },  // qopf;
+  { 13322, 7, 0, 0x2057 },  // qprime;
+  { 13329, 5, 0, 0x1d4c6 },  // qscr;
+  { 13334, 12, 0, 0x210d },  // quaternions;
+  { 13346, 8, 0, 0x2a16 },  // quatint;
+  { 13354, 6, 0, 0x003f },  // quest;
+  { 13360, 8, 0, 0x225f },  // questeq;
+  { 13368, 4, 0, 0x0022 },  // quot
+  { 13372, 5, 0, 0x0022 },  // quot;
+  { 13377, 6, 0, 0x21db },  // rAarr;
+  { 13383, 5, 0, 0x21d2 },  // rArr;
+  { 13388, 7, 0, 0x291c },  // rAtail;
+  { 13395, 6, 0, 0x290f },  // rBarr;
+  { 13401, 5, 0, 0x2964 },  // rHar;
+  { 13406, 5, 2, 0x223d },  // race;
+  { 13411, 7, 0, 0x0155 },  // racute;
+  { 13418, 6, 0, 0x221a },  // radic;
+  { 13424, 9, 0, 0x29b3 },  // raemptyv;
+  { 13433, 5, 0, 0x27e9 },  // rang;
+  { 13438, 6, 0, 0x2992 },  // rangd;
+  { 13444, 6, 0, 0x29a5 },  // range;
+  { 13450, 7, 0, 0x27e9 },  // rangle;
+  { 13457, 5, 0, 0x00bb },  // raquo
+  { 13462, 6, 0, 0x00bb },  // raquo;
+  { 13468, 5, 0, 0x2192 },  // rarr;
+  { 13473, 7, 0, 0x2975 },  // rarrap;
+  { 13480, 6, 0, 0x21e5 },  // rarrb;
+  { 13486, 8, 0, 0x2920 },  // rarrbfs;
+  { 13494, 6, 0, 0x2933 },  // rarrc;
+  { 13500, 7, 0, 0x291e },  // rarrfs;
+  { 13507, 7, 0, 0x21aa },  // rarrhk;
+  { 13514, 7, 0, 0x21ac },  // rarrlp;
+  { 13521, 7, 0, 0x2945 },  // rarrpl;
+  { 13528, 8, 0, 0x2974 },  // rarrsim;
+  { 13536, 7, 0, 0x21a3 },  // rarrtl;
+  { 13543, 6, 0, 0x219d },  // rarrw;
+  { 13549, 7, 0, 0x291a },  // ratail;
+  { 13556, 6, 0, 0x2236 },  // ratio;
+  { 13562, 10, 0, 0x211a },  // rationals;
+  { 13572, 6, 0, 0x290d },  // rbarr;
+  { 13578, 6, 0, 0x2773 },  // rbbrk;
+  { 13584, 7, 0, 0x007d },  // rbrace;
+  { 13591, 7, 0, 0x005d },  // rbrack;
+  { 13598, 6, 0, 0x298c },  // rbrke;
+  { 13604, 8, 0, 0x298e },  // rbrksld;
+  { 13612, 8, 0, 0x2990 },  // rbrkslu;
+  { 13620, 7, 0, 0x0159 },  // rcaron;
+  { 13627, 7, 0, 0x0157 },  // rcedil;
+  { 13634, 6, 0, 0x2309 },  // rceil;
+  { 13640, 5, 0, 0x007d },  // rcub;
+  { 13645, 4, 0, 0x0440 },  // rcy;
+  { 13649, 5, 0, 0x2937 },  // rdca;
+  { 13654, 8, 0, 0x2969 },  // rdldhar;
+  { 13662, 6, 0, 0x201d },  // rdquo;
+  { 13668, 7, 0, 0x201d },  // rdquor;
+  { 13675, 5, 0, 0x21b3 },  // rdsh;
+  { 13680, 5, 0, 0x211c },  // real;
+  { 13685, 8, 0, 0x211b },  // realine;
+  { 13693, 9, 0, 0x211c },  // realpart;
+  { 13702, 6, 0, 0x211d },  // reals;
+  { 13708, 5, 0, 0x25ad },  // rect;
+  { 13713, 3, 0, 0x00ae },  // reg
+  { 13716, 4, 0, 0x00ae },  // reg;
+  { 13720, 7, 0, 0x297d },  // rfisht;
+  { 13727, 7, 0, 0x230b },  // rfloor;
+  { 13734, 4, 0, 0x1d52f },  // rfr;
+  { 13738, 6, 0, 0x21c1 },  // rhard;
+  { 13744, 6, 0, 0x21c0 },  // rharu;
+  { 13750, 7, 0, 0x296c },  // rharul;
+  { 13757, 4, 0, 0x03c1 },  // rho;
+  { 13761, 5, 0, 0x03f1 },  // rhov;
+  { 13766, 11, 0, 0x2192 },  // rightarrow;
+  { 13777, 15, 0, 0x21a3 },  // rightarrowtail;
+  { 13792, 17, 0, 0x21c1 },  // rightharpoondown;
+  { 13809, 15, 0, 0x21c0 },  // rightharpoonup;
+  { 13824, 16, 0, 0x21c4 },  // rightleftarrows;
+  { 13840, 18, 0, 0x21cc },  // rightleftharpoons;
+  { 13858, 17, 0, 0x21c9 },  // rightrightarrows;
+  { 13875, 16, 0, 0x219d },  // rightsquigarrow;
+  { 13891, 16, 0, 0x22cc },  // rightthreetimes;
+  { 13907, 5, 0, 0x02da },  // ring;
+  { 13912, 13, 0, 0x2253 },  // risingdotseq;
+  { 13925, 6, 0, 0x21c4 },  // rlarr;
+  { 13931, 6, 0, 0x21cc },  // rlhar;
+  { 13937, 4, 0, 0x200f },  // rlm;
+  { 13941, 7, 0, 0x23b1 },  // rmoust;
+  { 13948, 11, 0, 0x23b1 },  // rmoustache;
+  { 13959, 6, 0, 0x2aee },  // rnmid;
+  { 13965, 6, 0, 0x27ed },  // roang;
+  { 13971, 6, 0, 0x21fe },  // roarr;
+  { 13977, 6, 0, 0x27e7 },  // robrk;
+  { 13983, 6, 0, 0x2986 },  // ropar;
+  { 13989, 5, 0, 0x1d563 },  // ropf;
+  { 13994, 7, 0, 0x2a2e },  // roplus;
+  { 14001, 8, 0, 0x2a35 },  // rotimes;
+  { 14009, 5, 0, 0x0029 },  // rpar;
+  { 14014, 7, 0, 0x2994 },  // rpargt;
+  { 14021, 9, 0, 0x2a12 },  // rppolint;
+  { 14030, 6, 0, 0x21c9 },  // rrarr;
+  { 14036, 7, 0, 0x203a },  // rsaquo;
+  { 14043, 5, 0, 0x1d4c7 },  // rscr;
+  { 14048, 4, 0, 0x21b1 },  // rsh;
+  { 14052, 5, 0, 0x005d },  // rsqb;
+  { 14057, 6, 0, 0x2019 },  // rsquo;
+  { 14063, 7, 0, 0x2019 },  // rsquor;
+  { 14070, 7, 0, 0x22cc },  // rthree;
+  { 14077, 7, 0, 0x22ca },  // rtimes;
+  { 14084, 5, 0, 0x25b9 },  // rtri;
+  { 14089, 6, 0, 0x22b5 },  // rtrie;
+  { 14095, 6, 0, 0x25b8 },  // rtrif;
+  { 14101, 9, 0, 0x29ce },  // rtriltri;
+  { 14110, 8, 0, 0x2968 },  // ruluhar;
+  { 14118, 3, 0, 0x211e },  // rx;
+  { 14121, 7, 0, 0x015b },  // sacute;
+  { 14128, 6, 0, 0x201a },  // sbquo;
+  { 14134, 3, 0, 0x227b },  // sc;
+  { 14137, 4, 0, 0x2ab4 },  // scE;
+  { 14141, 5, 0, 0x2ab8 },  // scap;
+  { 14146, 7, 0, 0x0161 },  // scaron;
+  { 14153, 6, 0, 0x227d },  // sccue;
+  { 14159, 4, 0, 0x2ab0 },  // sce;
+  { 14163, 7, 0, 0x015f },  // scedil;
+  { 14170, 6, 0, 0x015d },  // scirc;
+  { 14176, 5, 0, 0x2ab6 },  // scnE;
+  { 14181, 6, 0, 0x2aba },  // scnap;
+  { 14187, 7, 0, 0x22e9 },  // scnsim;
+  { 14194, 9, 0, 0x2a13 },  // scpolint;
+  { 14203, 6, 0, 0x227f },  // scsim;
+  { 14209, 4, 0, 0x0441 },  // scy;
+  { 14213, 5, 0, 0x22c5 },  // sdot;
+  { 14218, 6, 0, 0x22a1 },  // sdotb;
+  { 14224, 6, 0, 0x2a66 },  // sdote;
+  { 14230, 6, 0, 0x21d8 },  // seArr;
+  { 14236, 7, 0, 0x2925 },  // searhk;
+  { 14243, 6, 0, 0x2198 },  // searr;
+  { 14249, 8, 0, 0x2198 },  // searrow;
+  { 14257, 4, 0, 0x00a7 },  // sect
+  { 14261, 5, 0, 0x00a7 },  // sect;
+  { 14266, 5, 0, 0x003b },  // semi;
+  { 14271, 7, 0, 0x2929 },  // seswar;
+  { 14278, 9, 0, 0x2216 },  // setminus;
+  { 14287, 6, 0, 0x2216 },  // setmn;
+  { 14293, 5, 0, 0x2736 },  // sext;
+  { 14298, 4, 0, 0x1d530 },  // sfr;
+  { 14302, 7, 0, 0x2322 },  // sfrown;
+  { 14309, 6, 0, 0x266f },  // sharp;
+  { 14315, 7, 0, 0x0449 },  // shchcy;
+  { 14322, 5, 0, 0x0448 },  // shcy;
+  { 14327, 9, 0, 0x2223 },  // shortmid;
+  { 14336, 14, 0, 0x2225 },  // shortparallel;
+  { 14350, 3, 0, 0x00ad },  // shy
+  { 14353, 4, 0, 0x00ad },  // shy;
+  { 14357, 6, 0, 0x03c3 },  // sigma;
+  { 14363, 7, 0, 0x03c2 },  // sigmaf;
+  { 14370, 7, 0, 0x03c2 },  // sigmav;
+  { 14377, 4, 0, 0x223c },  // sim;
+  { 14381, 7, 0, 0x2a6a },  // simdot;
+  { 14388, 5, 0, 0x2243 },  // sime;
+  { 14393, 6, 0, 0x2243 },  // simeq;
+  { 14399, 5, 0, 0x2a9e },  // simg;
+  { 14404, 6, 0, 0x2aa0 },  // simgE;
+  { 14410, 5, 0, 0x2a9d },  // siml;
+  { 14415, 6, 0, 0x2a9f },  // simlE;
+  { 14421, 6, 0, 0x2246 },  // simne;
+  { 14427, 8, 0, 0x2a24 },  // simplus;
+  { 14435, 8, 0, 0x2972 },  // simrarr;
+  { 14443, 6, 0, 0x2190 },  // slarr;
+  { 14449, 14, 0, 0x2216 },  // smallsetminus;
+  { 14463, 7, 0, 0x2a33 },  // smashp;
+  { 14470, 9, 0, 0x29e4 },  // smeparsl;
+  { 14479, 5, 0, 0x2223 },  // smid;
+  { 14484, 6, 0, 0x2323 },  // smile;
+  { 14490, 4, 0, 0x2aaa },  // smt;
+  { 14494, 5, 0, 0x2aac },  // smte;
+  { 14499, 6, 8, 0x2aac },  // smtes;
+  { 14505, 7, 0, 0x044c },  // softcy;
+  { 14512, 4, 0, 0x002f },  // sol;
+  { 14516, 5, 0, 0x29c4 },  // solb;
+  { 14521, 7, 0, 0x233f },  // solbar;
+  { 14528, 5, 0, 0x1d564 },  // sopf;
+  { 14533, 7, 0, 0x2660 },  // spades;
+  { 14540, 10, 0, 0x2660 },  // spadesuit;
+  { 14550, 5, 0, 0x2225 },  // spar;
+  { 14555, 6, 0, 0x2293 },  // sqcap;
+  { 14561, 7, 8, 0x2293 },  // sqcaps;
+  { 14568, 6, 0, 0x2294 },  // sqcup;
+  { 14574, 7, 8, 0x2294 },  // sqcups;
+  { 14581, 6, 0, 0x228f },  // sqsub;
+  { 14587, 7, 0, 0x2291 },  // sqsube;
+  { 14594, 9, 0, 0x228f },  // sqsubset;
+  { 14603, 11, 0, 0x2291 },  // sqsubseteq;
+  { 14614, 6, 0, 0x2290 },  // sqsup;
+  { 14620, 7, 0, 0x2292 },  // sqsupe;
+  { 14627, 9, 0, 0x2290 },  // sqsupset;
+  { 14636, 11, 0, 0x2292 },  // sqsupseteq;
+  { 14647, 4, 0, 0x25a1 },  // squ;
+  { 14651, 7, 0, 0x25a1 },  // square;
+  { 14658, 7, 0, 0x25aa },  // squarf;
+  { 14665, 5, 0, 0x25aa },  // squf;
+  { 14670, 6, 0, 0x2192 },  // srarr;
+  { 14676, 5, 0, 0x1d4c8 },  // sscr;
+  { 14681, 7, 0, 0x2216 },  // ssetmn;
+  { 14688, 7, 0, 0x2323 },  // ssmile;
+  { 14695, 7, 0, 0x22c6 },  // sstarf;
+  { 14702, 5, 0, 0x2606 },  // star;
+  { 14707, 6, 0, 0x2605 },  // starf;
+  { 14713, 16, 0, 0x03f5 },  // straightepsilon;
+  { 14729, 12, 0, 0x03d5 },  // straightphi;
+  { 14741, 6, 0, 0x00af },  // strns;
+  { 14747, 4, 0, 0x2282 },  // sub;
+  { 14751, 5, 0, 0x2ac5 },  // subE;
+  { 14756, 7, 0, 0x2abd },  // subdot;
+  { 14763, 5, 0, 0x2286 },  // sube;
+  { 14768, 8, 0, 0x2ac3 },  // subedot;
+  { 14776, 8, 0, 0x2ac1 },  // submult;
+  { 14784, 6, 0, 0x2acb },  // subnE;
+  { 14790, 6, 0, 0x228a },  // subne;
+  { 14796, 8, 0, 0x2abf },  // subplus;
+  { 14804, 8, 0, 0x2979 },  // subrarr;
+  { 14812, 7, 0, 0x2282 },  // subset;
+  { 14819, 9, 0, 0x2286 },  // subseteq;
+  { 14828, 10, 0, 0x2ac5 },  // subseteqq;
+  { 14838, 10, 0, 0x228a },  // subsetneq;
+  { 14848, 11, 0, 0x2acb },  // subsetneqq;
+  { 14859, 7, 0, 0x2ac7 },  // subsim;
+  { 14866, 7, 0, 0x2ad5 },  // subsub;
+  { 14873, 7, 0, 0x2ad3 },  // subsup;
+  { 14880, 5, 0, 0x227b },  // succ;
+  { 14885, 11, 0, 0x2ab8 },  // succapprox;
+  { 14896, 12, 0, 0x227d },  // succcurlyeq;
+  { 14908, 7, 0, 0x2ab0 },  // succeq;
+  { 14915, 12, 0, 0x2aba },  // succnapprox;
+  { 14927, 9, 0, 0x2ab6 },  // succneqq;
+  { 14936, 9, 0, 0x22e9 },  // succnsim;
+  { 14945, 8, 0, 0x227f },  // succsim;
+  { 14953, 4, 0, 0x2211 },  // sum;
+  { 14957, 5, 0, 0x266a },  // sung;
+  { 14962, 4, 0, 0x00b9 },  // sup1
+  { 14966, 5, 0, 0x00b9 },  // sup1;
+  { 14971, 4, 0, 0x00b2 },  // sup2
+  { 14975, 5, 0, 0x00b2 },  // sup2;
+  { 14980, 4, 0, 0x00b3 },  // sup3
+  { 14984, 5, 0, 0x00b3 },  // sup3;
+  { 14989, 4, 0, 0x2283 },  // sup;
+  { 14993, 5, 0, 0x2ac6 },  // supE;
+  { 14998, 7, 0, 0x2abe },  // supdot;
+  { 15005, 8, 0, 0x2ad8 },  // supdsub;
+  { 15013, 5, 0, 0x2287 },  // supe;
+  { 15018, 8, 0, 0x2ac4 },  // supedot;
+  { 15026, 8, 0, 0x27c9 },  // suphsol;
+  { 15034, 8, 0, 0x2ad7 },  // suphsub;
+  { 15042, 8, 0, 0x297b },  // suplarr;
+  { 15050, 8, 0, 0x2ac2 },  // supmult;
+  { 15058, 6, 0, 0x2acc },  // supnE;
+  { 15064, 6, 0, 0x228b },  // supne;
+  { 15070, 8, 0, 0x2ac0 },  // supplus;
+  { 15078, 7, 0, 0x2283 },  // supset;
+  { 15085, 9, 0, 0x2287 },  // supseteq;
+  { 15094, 10, 0, 0x2ac6 },  // supseteqq;
+  { 15104, 10, 0, 0x228b },  // supsetneq;
+  { 15114, 11, 0, 0x2acc },  // supsetneqq;
+  { 15125, 7, 0, 0x2ac8 },  // supsim;
+  { 15132, 7, 0, 0x2ad4 },  // supsub;
+  { 15139, 7, 0, 0x2ad6 },  // supsup;
+  { 15146, 6, 0, 0x21d9 },  // swArr;
+  { 15152, 7, 0, 0x2926 },  // swarhk;
+  { 15159, 6, 0, 0x2199 },  // swarr;
+  { 15165, 8, 0, 0x2199 },  // swarrow;
+  { 15173, 7, 0, 0x292a },  // swnwar;
+  { 15180, 5, 0, 0x00df },  // szlig
+  { 15185, 6, 0, 0x00df },  // szlig;
+  { 15191, 7, 0, 0x2316 },  // target;
+  { 15198, 4, 0, 0x03c4 },  // tau;
+  { 15202, 5, 0, 0x23b4 },  // tbrk;
+  { 15207, 7, 0, 0x0165 },  // tcaron;
+  { 15214, 7, 0, 0x0163 },  // tcedil;
+  { 15221, 4, 0, 0x0442 },  // tcy;
+  { 15225, 5, 0, 0x20db },  // tdot;
+  { 15230, 7, 0, 0x2315 },  // telrec;
+  { 15237, 4, 0, 0x1d531 },  // tfr;
+  { 15241, 7, 0, 0x2234 },  // there4;
+  { 15248, 10, 0, 0x2234 },  // therefore;
+  { 15258, 6, 0, 0x03b8 },  // theta;
+  { 15264, 9, 0, 0x03d1 },  // thetasym;
+  { 15273, 7, 0, 0x03d1 },  // thetav;
+  { 15280, 12, 0, 0x2248 },  // thickapprox;
+  { 15292, 9, 0, 0x223c },  // thicksim;
+  { 15301, 7, 0, 0x2009 },  // thinsp;
+  { 15308, 6, 0, 0x2248 },  // thkap;
+  { 15314, 7, 0, 0x223c },  // thksim;
+  { 15321, 5, 0, 0x00fe },  // thorn
+  { 15326, 6, 0, 0x00fe },  // thorn;
+  { 15332, 6, 0, 0x02dc },  // tilde;
+  { 15338, 5, 0, 0x00d7 },  // times
+  { 15343, 6, 0, 0x00d7 },  // times;
+  { 15349, 7, 0, 0x22a0 },  // timesb;
+  { 15356, 9, 0, 0x2a31 },  // timesbar;
+  { 15365, 7, 0, 0x2a30 },  // timesd;
+  { 15372, 5, 0, 0x222d },  // tint;
+  { 15377, 5, 0, 0x2928 },  // toea;
+  { 15382, 4, 0, 0x22a4 },  // top;
+  { 15386, 7, 0, 0x2336 },  // topbot;
+  { 15393, 7, 0, 0x2af1 },  // topcir;
+  { 15400, 5, 0, 0x1d565 },  // topf;
+  { 15405, 8, 0, 0x2ada },  // topfork;
+  { 15413, 5, 0, 0x2929 },  // tosa;
+  { 15418, 7, 0, 0x2034 },  // tprime;
+  { 15425, 6, 0, 0x2122 },  // trade;
+  { 15431, 9, 0, 0x25b5 },  // triangle;
+  { 15440, 13, 0, 0x25bf },  // triangledown;
+  { 15453, 13, 0, 0x25c3 },  // triangleleft;
+  { 15466, 15, 0, 0x22b4 },  // trianglelefteq;
+  { 15481, 10, 0, 0x225c },  // triangleq;
+  { 15491, 14, 0, 0x25b9 },  // triangleright;
+  { 15505, 16, 0, 0x22b5 },  // trianglerighteq;
+  { 15521, 7, 0, 0x25ec },  // tridot;
+  { 15528, 5, 0, 0x225c },  // trie;
+  { 15533, 9, 0, 0x2a3a },  // triminus;
+  { 15542, 8, 0, 0x2a39 },  // triplus;
+  { 15550, 6, 0, 0x29cd },  // trisb;
+  { 15556, 8, 0, 0x2a3b },  // tritime;
+  { 15564, 9, 0, 0x23e2 },  // trpezium;
+  { 15573, 5, 0, 0x1d4c9 },  // tscr;
+  { 15578, 5, 0, 0x0446 },  // tscy;
+  { 15583, 6, 0, 0x045b },  // tshcy;
+  { 15589, 7, 0, 0x0167 },  // tstrok;
+  { 15596, 6, 0, 0x226c },  // twixt;
+  { 15602, 17, 0, 0x219e },  // twoheadleftarrow;
+  { 15619, 18, 0, 0x21a0 },  // twoheadrightarrow;
+  { 15637, 5, 0, 0x21d1 },  // uArr;
+  { 15642, 5, 0, 0x2963 },  // uHar;
+  { 15647, 6, 0, 0x00fa },  // uacute
+  { 15653, 7, 0, 0x00fa },  // uacute;
+  { 15660, 5, 0, 0x2191 },  // uarr;
+  { 15665, 6, 0, 0x045e },  // ubrcy;
+  { 15671, 7, 0, 0x016d },  // ubreve;
+  { 15678, 5, 0, 0x00fb },  // ucirc
+  { 15683, 6, 0, 0x00fb },  // ucirc;
+  { 15689, 4, 0, 0x0443 },  // ucy;
+  { 15693, 6, 0, 0x21c5 },  // udarr;
+  { 15699, 7, 0, 0x0171 },  // udblac;
+  { 15706, 6, 0, 0x296e },  // udhar;
+  { 15712, 7, 0, 0x297e },  // ufisht;
+  { 15719, 4, 0, 0x1d532 },  // ufr;
+  { 15723, 6, 0, 0x00f9 },  // ugrave
+  { 15729, 7, 0, 0x00f9 },  // ugrave;
+  { 15736, 6, 0, 0x21bf },  // uharl;
+  { 15742, 6, 0, 0x21be },  // uharr;
+  { 15748, 6, 0, 0x2580 },  // uhblk;
+  { 15754, 7, 0, 0x231c },  // ulcorn;
+  { 15761, 9, 0, 0x231c },  // ulcorner;
+  { 15770, 7, 0, 0x230f },  // ulcrop;
+  { 15777, 6, 0, 0x25f8 },  // ultri;
+  { 15783, 6, 0, 0x016b },  // umacr;
+  { 15789, 3, 0, 0x00a8 },  // uml
+  { 15792, 4, 0, 0x00a8 },  // uml;
+  { 15796, 6, 0, 0x0173 },  // uogon;
+  { 15802, 5, 0, 0x1d566 },  // uopf;
+  { 15807, 8, 0, 0x2191 },  // uparrow;
+  { 15815, 12, 0, 0x2195 },  // updownarrow;
+  { 15827, 14, 0, 0x21bf },  // upharpoonleft;
+  { 15841, 15, 0, 0x21be },  // upharpoonright;
+  { 15856, 6, 0, 0x228e },  // uplus;
+  { 15862, 5, 0, 0x03c5 },  // upsi;
+  { 15867, 6, 0, 0x03d2 },  // upsih;
+  { 15873, 8, 0, 0x03c5 },  // upsilon;
+  { 15881, 11, 0, 0x21c8 },  // upuparrows;
+  { 15892, 7, 0, 0x231d },  // urcorn;
+  { 15899, 9, 0, 0x231d },  // urcorner;
+  { 15908, 7, 0, 0x230e },  // urcrop;
+  { 15915, 6, 0, 0x016f },  // uring;
+  { 15921, 6, 0, 0x25f9 },  // urtri;
+  { 15927, 5, 0, 0x1d4ca },  // uscr;
+  { 15932, 6, 0, 0x22f0 },  // utdot;
+  { 15938, 7, 0, 0x0169 },  // utilde;
+  { 15945, 5, 0, 0x25b5 },  // utri;
+  { 15950, 6, 0, 0x25b4 },  // utrif;
+  { 15956, 6, 0, 0x21c8 },  // uuarr;
+  { 15962, 4, 0, 0x00fc },  // uuml
+  { 15966, 5, 0, 0x00fc },  // uuml;
+  { 15971, 8, 0, 0x29a7 },  // uwangle;
+  { 15979, 5, 0, 0x21d5 },  // vArr;
+  { 15984, 5, 0, 0x2ae8 },  // vBar;
+  { 15989, 6, 0, 0x2ae9 },  // vBarv;
+  { 15995, 6, 0, 0x22a8 },  // vDash;
+  { 16001, 7, 0, 0x299c },  // vangrt;
+  { 16008, 11, 0, 0x03f5 },  // varepsilon;
+  { 16019, 9, 0, 0x03f0 },  // varkappa;
+  { 16028, 11, 0, 0x2205 },  // varnothing;
+  { 16039, 7, 0, 0x03d5 },  // varphi;
+  { 16046, 6, 0, 0x03d6 },  // varpi;
+  { 16052, 10, 0, 0x221d },  // varpropto;
+  { 16062, 5, 0, 0x2195 },  // varr;
+  { 16067, 7, 0, 0x03f1 },  // varrho;
+  { 16074, 9, 0, 0x03c2 },  // varsigma;
+  { 16083, 13, 8, 0x228a },  // varsubsetneq;
+  { 16096, 14, 8, 0x2acb },  // varsubsetneqq;
+  { 16110, 13, 8, 0x228b },  // varsupsetneq;
+  { 16123, 14, 8, 0x2acc },  // varsupsetneqq;
+  { 16137, 9, 0, 0x03d1 },  // vartheta;
+  { 16146, 16, 0, 0x22b2 },  // vartriangleleft;
+  { 16162, 17, 0, 0x22b3 },  // vartriangleright;
+  { 16179, 4, 0, 0x0432 },  // vcy;
+  { 16183, 6, 0, 0x22a2 },  // vdash;
+  { 16189, 4, 0, 0x2228 },  // vee;
+  { 16193, 7, 0, 0x22bb },  // veebar;
+  { 16200, 6, 0, 0x225a },  // veeeq;
+  { 16206, 7, 0, 0x22ee },  // vellip;
+  { 16213, 7, 0, 0x007c },  // verbar;
+  { 16220, 5, 0, 0x007c },  // vert;
+  { 16225, 4, 0, 0x1d533 },  // vfr;
+  { 16229, 6, 0, 0x22b2 },  // vltri;
+  { 16235, 6, 6, 0x2282 },  // vnsub;
+  { 16241, 6, 6, 0x2283 },  // vnsup;
+  { 16247, 5, 0, 0x1d567 },  // vopf;
+  { 16252, 6, 0, 0x221d },  // vprop;
+  { 16258, 6, 0, 0x22b3 },  // vrtri;
+  { 16264, 5, 0, 0x1d4cb },  // vscr;
+  { 16269, 7, 8, 0x2acb },  // vsubnE;
+  { 16276, 7, 8, 0x228a },  // vsubne;
+  { 16283, 7, 8, 0x2acc },  // vsupnE;
+  { 16290, 7, 8, 0x228b },  // vsupne;
+  { 16297, 8, 0, 0x299a },  // vzigzag;
+  { 16305, 6, 0, 0x0175 },  // wcirc;
+  { 16311, 7, 0, 0x2a5f },  // wedbar;
+  { 16318, 6, 0, 0x2227 },  // wedge;
+  { 16324, 7, 0, 0x2259 },  // wedgeq;
+  { 16331, 7, 0, 0x2118 },  // weierp;
+  { 16338, 4, 0, 0x1d534 },  // wfr;
+  { 16342, 5, 0, 0x1d568 },  // wopf;
+  { 16347, 3, 0, 0x2118 },  // wp;
+  { 16350, 3, 0, 0x2240 },  // wr;
+  { 16353, 7, 0, 0x2240 },  // wreath;
+  { 16360, 5, 0, 0x1d4cc },  // wscr;
+  { 16365, 5, 0, 0x22c2 },  // xcap;
+  { 16370, 6, 0, 0x25ef },  // xcirc;
+  { 16376, 5, 0, 0x22c3 },  // xcup;
+  { 16381, 6, 0, 0x25bd },  // xdtri;
+  { 16387, 4, 0, 0x1d535 },  // xfr;
+  { 16391, 6, 0, 0x27fa },  // xhArr;
+  { 16397, 6, 0, 0x27f7 },  // xharr;
+  { 16403, 3, 0, 0x03be },  // xi;
+  { 16406, 6, 0, 0x27f8 },  // xlArr;
+  { 16412, 6, 0, 0x27f5 },  // xlarr;
+  { 16418, 5, 0, 0x27fc },  // xmap;
+  { 16423, 5, 0, 0x22fb },  // xnis;
+  { 16428, 6, 0, 0x2a00 },  // xodot;
+  { 16434, 5, 0, 0x1d569 },  // xopf;
+  { 16439, 7, 0, 0x2a01 },  // xoplus;
+  { 16446, 7, 0, 0x2a02 },  // xotime;
+  { 16453, 6, 0, 0x27f9 },  // xrArr;
+  { 16459, 6, 0, 0x27f6 },  // xrarr;
+  { 16465, 5, 0, 0x1d4cd },  // xscr;
+  { 16470, 7, 0, 0x2a06 },  // xsqcup;
+  { 16477, 7, 0, 0x2a04 },  // xuplus;
+  { 16484, 6, 0, 0x25b3 },  // xutri;
+  { 16490, 5, 0, 0x22c1 },  // xvee;
+  { 16495, 7, 0, 0x22c0 },  // xwedge;
+  { 16502, 6, 0, 0x00fd },  // yacute
+  { 16508, 7, 0, 0x00fd },  // yacute;
+  { 16515, 5, 0, 0x044f },  // yacy;
+  { 16520, 6, 0, 0x0177 },  // ycirc;
+  { 16526, 4, 0, 0x044b },  // ycy;
+  { 16530, 3, 0, 0x00a5 },  // yen
+  { 16533, 4, 0, 0x00a5 },  // yen;
+  { 16537, 4, 0, 0x1d536 },  // yfr;
+  { 16541, 5, 0, 0x0457 },  // yicy;
+  { 16546, 5, 0, 0x1d56a },  // yopf;
+  { 16551, 5, 0, 0x1d4ce },  // yscr;
+  { 16556, 5, 0, 0x044e },  // yucy;
+  { 16561, 4, 0, 0x00ff },  // yuml
+  { 16565, 5, 0, 0x00ff },  // yuml;
+  { 16570, 7, 0, 0x017a },  // zacute;
+  { 16577, 7, 0, 0x017e },  // zcaron;
+  { 16584, 4, 0, 0x0437 },  // zcy;
+  { 16588, 5, 0, 0x017c },  // zdot;
+  { 16593, 7, 0, 0x2128 },  // zeetrf;
+  { 16600, 5, 0, 0x03b6 },  // zeta;
+  { 16605, 4, 0, 0x1d537 },  // zfr;
+  { 16609, 5, 0, 0x0436 },  // zhcy;
+  { 16614, 8, 0, 0x21dd },  // zigrarr;
+  { 16622, 5, 0, 0x1d56b },  // zopf;
+  { 16627, 5, 0, 0x1d4cf },  // zscr;
+  { 16632, 4, 0, 0x200d },  // zwj;
+  { 16636, 5, 0, 0x200c },  // zwnj;
+};
+
+// Index of the first reference starting with A-Z, then a-z, and the end.
+static const unsigned short kNamedRefBuckets[] = {
+  0, 27, 39, 75, 129, 159, 167, 189, 201, 230, 237, 245,
+  305, 314, 386, 415, 434, 439, 484, 524, 547, 587, 604, 609,
+  613, 624, 634, 703, 819, 918, 984, 1051, 1090, 1150, 1178, 1234,
+  1242, 1252, 1406, 1446, 1614, 1675, 1744, 1755, 1859, 2017, 2075, 2127,
+  2169, 2180, 2204, 2218, 2231
+};
+
+// Length of the longest name, with the semicolon.
+static const size_t kMaxNamedRefLength = 32;
+// Length of the longest name that may be used without a semicolon.
+static const size_t kMaxLegacyNamedRefLength = 6;
@@ -63,11 +63,12 @@ extern "C" {
  * text (which in most languages that bind to C implies pointer arithmetic on a
  * buffer of bytes), while the column field is often used to reference a
  * particular column on a printable display, which nowadays is usually UTF-8.
+ * The offset is a size_t, so that buffers over 4 gigabytes can be parsed.
  */
 typedef struct {
   unsigned int line;
   unsigned int column;
-  unsigned int offset;
+  size_t offset;
 } GumboSourcePosition;
 
 /**
@@ -128,10 +129,10 @@ typedef struct {
   void** data;
 
   /** Number of elements currently in the vector. */
-  unsigned int length;
+  size_t length;
 
   /** Current array capacity. */
-  unsigned int capacity;
+  size_t capacity;
 } GumboVector;
 
 /** An empty (0-length, 0-capacity) GumboVector. */
@@ -207,6 +208,12 @@ const char* gumbo_normalize_svg_tagname(const GumboStringPiece* tagname);
 GumboTag gumbo_tag_enum(const char* tagname);
 GumboTag gumbo_tagn_enum(const char* tagname, int length);
 
+/**
+ * Like gumbo_tagn_enum, but `tagname` must already be in lowercase, which
+ * saves case-folding it again.
+ */
+GumboTag gumbo_tagn_enum_lowercase(const char* tagname, int length);
+
 /**
  * Attribute namespaces.
  * HTML includes special handling for XLink, XML, and XMLNS namespaces on
@@ -273,7 +280,10 @@ typedef struct {
    */
   GumboSourcePosition name_end;
 
-  /** The starting position of the attribute value. */
+  /**
+   * The starting position of the attribute value.  For an attribute without a
+   * value, this and value_end span its name.
+   */
   GumboSourcePosition value_start;
 
   /** The ending position of the attribute value. */
@@ -414,6 +424,30 @@ typedef enum {
    * should've been foster-parented, if verbatim mode is set).
    */
   GUMBO_INSERTION_FOSTER_PARENTED = 1 << 10,
+
+  /**
+   * A flag for elements whose attributes have been changed through the
+   * gumbo_edit.h API after parsing.
+   */
+  GUMBO_INSERTION_ATTRIBUTES_EDITED = 1 << 11,
+
+  /**
+   * A flag for nodes that have had children inserted or removed through the
+   * gumbo_edit.h API after parsing.
+   */
+  GUMBO_INSERTION_CHILDREN_EDITED = 1 << 12,
+
+  /**
+   * A flag for nodes that have an edited node among their descendants.  Nodes
+   * with none of the *_EDITED flags still match their text in the source.
+   */
+  GUMBO_INSERTION_DESCENDANT_EDITED = 1 << 13,
+
+  /**
+   * A flag for elements whose content has been discarded because their tag is
+   * listed in the prune_tags option.
+   */
+  GUMBO_INSERTION_CONTENT_PRUNED = 1 << 14,
 } GumboParseFlags;
 
 
@@ -524,7 +558,7 @@ struct GumboInternalNode {
   GumboNode* parent;
 
   /** The index within the parent's children vector of this node. */
-  unsigned int index_within_parent;
+  size_t index_within_parent;
 
   /**
    * A bitvector of flags containing information about why this element was
@@ -556,6 +590,20 @@ typedef void* (*GumboAllocatorFunction)(void* userdata, size_t size);
  */
 typedef void (*GumboDeallocatorFunction)(void* userdata, void* ptr);
 
+/**
+ * The type for element callbacks of the tree builder.  Takes the
+ * 'userdata' member of GumboOptions as its first argument and an
+ * element (or template) node as the second one.
+ */
+typedef void (*GumboElementCallback)(void* userdata, GumboNode* element);
+
+/**
+ * The type for the stop callback.  Takes the 'userdata' member of
+ * GumboOptions as its first argument and the offset of the input parsed so
+ * far as the second one.  Returns true to stop parsing.
+ */
+typedef bool (*GumboStopCallback)(void* userdata, size_t offset);
+
 /**
  * Input struct containing configuration options for the parser.
  * These let you specify alternate memory managers, provide different error
@@ -589,11 +637,181 @@ typedef struct GumboInternalOptions {
    * Default: -1
    */
   int max_errors;
+
+  /**
+   * Called when an element is pushed onto the stack of open elements, after it
+   * has been inserted into the tree and before any of its children.  This
+   * includes formatting elements cloned by the parser.
+   * Default: NULL.
+   */
+  GumboElementCallback element_start;
+
+  /**
+   * Called when an element is removed from the stack of open elements.  Its
+   * children and end position are final at this point, except for misnested
+   * formatting elements that the adoption agency algorithm may still move.
+   * Every element passed to element_start is passed here exactly once, but for
+   * misnested markup not necessarily in reverse order.
+   * Default: NULL.
+   */
+  GumboElementCallback element_end;
+
+  /**
+   * Stop parsing once an HTML element with this tag has been closed, e.g.
+   * GUMBO_TAG_HEAD to parse just the document head.  The rest of the token
+   * that closed the element is still processed.
+   * Default: GUMBO_TAG_LAST (parse the whole input).
+   */
+  GumboTag stop_after;
+
+  /**
+   * Called after each token has been processed; parsing stops if it returns
+   * true.
+   * Default: NULL.
+   */
+  GumboStopCallback should_stop;
+
+  /** Passed as the first argument to the element and stop callbacks. */
+  void* userdata;
+
+  /**
+   * Tags of elements whose content should not be kept, e.g. script and style
+   * for text extraction.  An array of GUMBO_TAG_LAST flags indexed by tag, or
+   * NULL.  The tokenizer still runs in the right states, so pruned elements
+   * end where they normally would, but they are left in the tree as empty
+   * placeholders with the GUMBO_INSERTION_CONTENT_PRUNED flag.  No text,
+   * comment or attribute inside them is allocated.  Tags match HTML elements
+   * and the svg and math elements, not SVG or MathML elements of the same
+   * name, such as the title of an SVG image.
+   * Default: NULL.
+   */
+  const bool* prune_tags;
+
+  /**
+   * Tags of elements that are removed from the tree and freed once they have
+   * been closed, so that memory stays bounded by the depth of the tree rather
+   * than its size, e.g. tr or li to stream a huge table or list.  An array of
+   * GUMBO_TAG_LAST flags indexed by tag, or NULL.  Use element_end to process
+   * them: the complete element is passed to it before it is evicted after
+   * the current token, except for evicted elements inside it, which are
+   * already gone.  Elements the tree builder may still refer to, such as
+   * misnested formatting elements inside them, and children of the document
+   * are kept.  Whitespace between evicted elements is kept too unless
+   * drop_whitespace is set.
+   * Default: NULL.
+   */
+  const bool* evict_tags;
+
+  /**
+   * Whether or not to leave out whitespace-only text (GUMBO_NODE_WHITESPACE),
+   * such as the indentation between tags.  The nodes are never created, so
+   * index_within_parent stays consistent.  Whitespace that renders is kept:
+   * the content of pre, textarea, listing and plaintext elements, and
+   * whitespace between phrasing content, as in <b>a</b> <i>b</i>.
+   * Default: false.
+   */
+  bool drop_whitespace;
+
+  /**
+   * Whether or not to leave out comments.
+   * Default: false.
+   */
+  bool drop_comments;
+
+  /**
+   * Limits that bound the time and memory spent on hostile documents.  Set a
+   * limit to -1 to disable it.
+   *
+   * Elements that would be nested deeper than max_tree_depth are inserted as
+   * siblings of the element at that depth instead, and formatting elements
+   * are not reconstructed there; the status is GUMBO_STATUS_TREE_TOO_DEEP.
+   * Parsing only stops, with the same status, when the element at the limit
+   * is one that cannot be closed early, such as a table cell.
+   *
+   * Parsing stops after the token that creates more than max_nodes nodes,
+   * with the status GUMBO_STATUS_TOO_MANY_NODES.
+   *
+   * Text nodes longer than max_text_length bytes and attribute values longer
+   * than max_attribute_length bytes are truncated, and attributes after the
+   * first max_attributes of a tag are dropped.  Parsing goes on, and the
+   * status is GUMBO_STATUS_TRUNCATED.  The length limits are ptrdiff_t, so
+   * that they can go past 2 gigabytes like the input.
+   *
+   * Default: -1.
+   */
+  int max_tree_depth;
+  int max_nodes;
+  ptrdiff_t max_text_length;
+  ptrdiff_t max_attribute_length;
+  int max_attributes;
+
+  /**
+   * Called every cancel_check_interval tokens with cancel_userdata; parsing
+   * stops with the status GUMBO_STATUS_CANCELLED if it returns true.  Unlike
+   * should_stop, this is meant for checks too costly to run after every
+   * token, such as reading a clock for a deadline or a flag set by another
+   * thread.
+   * Default: NULL.
+   */
+  GumboStopCallback is_cancelled;
+
+  /** Passed as the first argument to is_cancelled. */
+  void* cancel_userdata;
+
+  /**
+   * The number of tokens between calls to is_cancelled.
+   * Default: 1024.
+   */
+  unsigned int cancel_check_interval;
+
+  /**
+   * Whether to keep track of the line and column of source positions.  If
+   * false, only their byte offset is tracked and line and column are 0, which
+   * takes some bookkeeping out of the tokenizer's per-character loop; use
+   * GumboLineIndex to compute them when they are needed.
+   * Default: true.
+   */
+  bool track_line_column;
 } GumboOptions;
 
 /** Default options struct; use this with gumbo_parse_with_options. */
 extern const GumboOptions kGumboDefaultOptions;
 
+/** The status of a parse. */
+typedef enum {
+  /** The whole input has been parsed. */
+  GUMBO_STATUS_OK,
+  /**
+   * Parsing was stopped by the stop_after or should_stop options.  The tree
+   * is completed as if the input ended where parsing stopped, with all open
+   * elements closed.
+   */
+  GUMBO_STATUS_STOPPED,
+  /**
+   * Text or attributes exceeding the max_text_length, max_attribute_length or
+   * max_attributes options have been truncated.  The rest of the input has
+   * been parsed.
+   */
+  GUMBO_STATUS_TRUNCATED,
+  /**
+   * Elements nested deeper than the max_tree_depth option allows have been
+   * flattened.  The rest of the input has been parsed, unless the element
+   * at the limit could not be closed, in which case parsing was stopped like
+   * with GUMBO_STATUS_STOPPED.
+   */
+  GUMBO_STATUS_TREE_TOO_DEEP,
+  /**
+   * Parsing was stopped like with GUMBO_STATUS_STOPPED because the tree has
+   * more nodes than the max_nodes option allows.
+   */
+  GUMBO_STATUS_TOO_MANY_NODES,
+  /**
+   * Parsing was stopped like with GUMBO_STATUS_STOPPED because the
+   * is_cancelled option returned true.
+   */
+  GUMBO_STATUS_CANCELLED
+} GumboOutputStatus;
+
 /** The output struct containing the results of the parse. */
 typedef struct GumboInternalOutput {
   /**
@@ -616,14 +834,15 @@ typedef struct GumboInternalOutput {
    * reported so we can work out something appropriate for your use-case.
    */
   GumboVector /* GumboError */ errors;
+
+  /** Whether the whole input has been parsed and kept in the tree. */
+  GumboOutputStatus status;
 } GumboOutput;
 
 /**
  * Parses a buffer of UTF8 text into an GumboNode parse tree.  The buffer must
  * live at least as long as the parse tree, as some fields (eg. original_text)
  * point directly into the original buffer.
- *
- * This doesn't support buffers longer than 4 gigabytes.
  */
 GumboOutput* gumbo_parse(const char* buffer);
 
@@ -645,6 +864,58 @@ GumboOutput* gumbo_parse_fragment(
 /** Release the memory used for the parse tree & parse errors. */
 void gumbo_destroy_output(GumboOutput* output);
 
+/**
+ * A parser that keeps its internal state and buffers from one parse to the
+ * next, which saves setting them up and tearing them down when parsing many
+ * small documents.  A parser must not be used by several threads at once.
+ */
+typedef struct GumboInternalParserHandle GumboParserHandle;
+
+/** Creates a reusable parser.  Nothing else is allocated until it is used. */
+GumboParserHandle* gumbo_create_parser(void);
+
+/**
+ * Same as gumbo_parse_fragment, but reuses the state of an earlier parse with
+ * the same parser.
+ */
+GumboOutput* gumbo_parser_parse_fragment(
+    GumboParserHandle* parser, const GumboOptions* options,
+    const char* buffer, size_t length, const GumboTag fragment_ctx,
+    const GumboNamespaceEnum fragment_namespace);
+
+/**
+ * Releases the state kept by the parser, e.g. after a large document has
+ * grown its buffers.  The parser can still be used afterwards.
+ */
+void gumbo_parser_reset(GumboParserHandle* parser);
+
+/** Releases the parser with the state it keeps. */
+void gumbo_destroy_parser(GumboParserHandle* parser);
+
+/**
+ * The starts of the lines of a source buffer, for computing the line and
+ * column of a byte offset after a parse with track_line_column = false.
+ * The buffer must outlive the index.
+ */
+typedef struct GumboInternalLineIndex GumboLineIndex;
+
+/**
+ * Indexes the lines of buffer.  tab_stop is taken from options, which should
+ * be the options of the parse.
+ */
+GumboLineIndex* gumbo_create_line_index(
+    const GumboOptions* options, const char* buffer, size_t length);
+
+/**
+ * Fills in the line and column of position from its offset, with the same
+ * values the parser sets when it tracks them.
+ */
+void gumbo_compute_position(
+    const GumboLineIndex* index, GumboSourcePosition* position);
+
+/** Releases a line index. */
+void gumbo_destroy_line_index(GumboLineIndex* index);
+
 /** Allocate a new freestanding node */
 GumboNode *gumbo_create_node(GumboNodeType type);
 
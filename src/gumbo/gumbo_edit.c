@@ -22,6 +22,7 @@
 #include "attribute.h"
 #include "vector.h"
 #include "gumbo.h"
+#include "gumbo_edit.h"
 #include "utf8.h"
 #include "util.h"
 
@@ -88,9 +89,10 @@ GumboNode*  gumbo_create_text_node(GumboNodeType type, const char * text) {
   assert(type != GUMBO_NODE_TEMPLATE);
   assert(type != GUMBO_NODE_ELEMENT);
   GumboNode* textnode = gumbo_create_node(type);
-  textnode->type = GUMBO_NODE_COMMENT;
   textnode->parse_flags = GUMBO_INSERTION_NORMAL;
   textnode->v.text.text = gumbo_strdup(text);
+  textnode->v.text.original_text = kGumboEmptyString;
+  textnode->v.text.start_pos = kGumboEmptySourcePosition;
   return textnode;
 }
 
@@ -145,6 +147,7 @@ void gumbo_append_node(GumboNode* parent, GumboNode* node) {
   node->index_within_parent = children->length;
   gumbo_vector_add((void*) node, children);
   assert(node->index_within_parent < children->length);
+  gumbo_mark_edited(parent, GUMBO_INSERTION_CHILDREN_EDITED);
 }
 
 
@@ -177,6 +180,7 @@ void gumbo_insert_node(GumboNode* node, GumboNode* target_parent, int target_ind
       sibling->index_within_parent = i;
       assert(sibling->index_within_parent < children->length);
     }
+    gumbo_mark_edited(parent, GUMBO_INSERTION_CHILDREN_EDITED);
   } else {
     gumbo_append_node(parent, node);
   }
@@ -197,6 +201,7 @@ void gumbo_remove_from_parent(GumboNode* node) {
   int index = gumbo_vector_index_of(children, node);
   assert(index != -1);
   gumbo_vector_remove_at(index, children);
+  gumbo_mark_edited(node->parent, GUMBO_INSERTION_CHILDREN_EDITED);
   node->parent = NULL;
   node->index_within_parent = -1;
   for (unsigned int i = index; i < children->length; ++i) {
@@ -206,6 +211,19 @@ void gumbo_remove_from_parent(GumboNode* node) {
 }
 
 
+// Sets the edit flag on a node and marks all its ancestors, stopping early at
+// an ancestor that has already been marked by a previous edit.
+void gumbo_mark_edited(GumboNode* node, GumboParseFlags flag) {
+  node->parse_flags |= flag;
+  for (GumboNode* parent = node->parent; parent; parent = parent->parent) {
+    if (parent->parse_flags & GUMBO_INSERTION_DESCENDANT_EDITED) {
+      break;
+    }
+    parent->parse_flags |= GUMBO_INSERTION_DESCENDANT_EDITED;
+  }
+}
+
+
 // Clones attributes, tags, etc. of a node, but does not copy the content (its children).  
 // The clone shares no structure with the original node: all owned strings and
 // values are fresh copies.
@@ -67,6 +67,12 @@ extern "C" {
 
   void gumbo_insert_node(GumboNode* node, GumboNode* target_parent, int target_index);
 
+  // Sets the edit flag (GUMBO_INSERTION_ATTRIBUTES_EDITED or GUMBO_INSERTION_CHILDREN_EDITED)
+  // on a node and GUMBO_INSERTION_DESCENDANT_EDITED on all its ancestors.
+  // The editing functions here call it themselves.
+
+  void gumbo_mark_edited(GumboNode* node, GumboParseFlags flag);
+
   // removes a node from its parent but does not destroy it
 
   // Note: Use gumbo_destroy_node(GumboNode * node) to properly destroy the node if outside 
@@ -85,10 +91,12 @@ extern "C" {
 
 
   // interface from attribute.h
+  // Note: gumbo_attribute_set_value does not know the element the attribute belongs to and
+  // does not mark it as edited. Use gumbo_element_set_attribute to change attribute values.
   void gumbo_attribute_set_value(GumboAttribute *attr, const char *value);
   void gumbo_destroy_attribute(GumboAttribute* attribute);
   void gumbo_element_set_attribute(GumboElement *element, const char *name, const char *value);
-  void gumbo_element_remove_attribute_at(GumboElement *element, unsigned int pos);
+  void gumbo_element_remove_attribute_at(GumboElement *element, size_t pos);
   void gumbo_element_remove_attribute(GumboElement *element, GumboAttribute *attr);
 
   // interface from vector.h
@@ -108,14 +116,14 @@ extern "C" {
 
   // Inserts an element at a specific index.  This is potentially O(N) time, but
   // is necessary for some of the spec's behavior.
-  void gumbo_vector_insert_at(void* element, int index, GumboVector* vector);
+  void gumbo_vector_insert_at(void* element, size_t index, GumboVector* vector);
 
   // Removes an element from the vector, or does nothing if the element is not in the vector.
   void gumbo_vector_remove(const void* element, GumboVector* vector);
 
   // Removes and returns an element at a specific index.  Note that this is
   // potentially O(N) time and should be used sparingly.
-  void* gumbo_vector_remove_at(int index, GumboVector* vector);
+  void* gumbo_vector_remove_at(size_t index, GumboVector* vector);
 
   int gumbo_vector_index_of(GumboVector* vector, const void* element);
   void gumbo_vector_splice(int where, int n_to_remove, void **data, int n_to_insert, GumboVector* vector);
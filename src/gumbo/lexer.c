@@ -0,0 +1,333 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lexer.h"
+
+#include <string.h>
+#include <strings.h>
+
+#include "error.h"
+#include "utf8.h"
+#include "util.h"
+#include "vector.h"
+
+typedef char gumbo_tagset[GUMBO_TAG_LAST];
+#define TAG(tag) [GUMBO_TAG_##tag] = 1
+
+#define TAGSET_INCLUDES(tagset, tag) \
+  ((tag) < GUMBO_TAG_LAST && tagset[(int) (tag)])
+
+// Start tags that break out of foreign content.
+// http://www.whatwg.org/specs/web-apps/current-work/multipage/tree-construction.html#parsing-main-inforeign
+static const gumbo_tagset kBreakoutTags = { TAG(B), TAG(BIG),
+    TAG(BLOCKQUOTE), TAG(BODY), TAG(BR), TAG(CENTER), TAG(CODE), TAG(DD),
+    TAG(DIV), TAG(DL), TAG(DT), TAG(EM), TAG(EMBED), TAG(H1), TAG(H2),
+    TAG(H3), TAG(H4), TAG(H5), TAG(H6), TAG(HEAD), TAG(HR), TAG(I), TAG(IMG),
+    TAG(LI), TAG(LISTING), TAG(MENU), TAG(META), TAG(NOBR), TAG(OL), TAG(P),
+    TAG(PRE), TAG(RUBY), TAG(S), TAG(SMALL), TAG(SPAN), TAG(STRONG),
+    TAG(STRIKE), TAG(SUB), TAG(SUP), TAG(TABLE), TAG(TT), TAG(U), TAG(UL),
+    TAG(VAR) };
+
+static const gumbo_tagset kSvgIntegrationPoints = { TAG(FOREIGNOBJECT),
+    TAG(DESC), TAG(TITLE) };
+
+static const gumbo_tagset kMathmlIntegrationPoints = { TAG(MI), TAG(MO),
+    TAG(MN), TAG(MS), TAG(MTEXT) };
+
+static bool token_has_attribute(const GumboToken* token, const char* name) {
+  return gumbo_get_attribute(&token->v.start_tag.attributes, name) != NULL;
+}
+
+static bool is_integration_point(
+    const GumboToken* token, GumboNamespaceEnum tag_namespace) {
+  GumboTag tag = token->v.start_tag.tag;
+  if (tag_namespace == GUMBO_NAMESPACE_SVG) {
+    return TAGSET_INCLUDES(kSvgIntegrationPoints, tag);
+  }
+  if (TAGSET_INCLUDES(kMathmlIntegrationPoints, tag)) {
+    return true;
+  }
+  if (tag == GUMBO_TAG_ANNOTATION_XML) {
+    GumboAttribute* encoding =
+        gumbo_get_attribute(&token->v.start_tag.attributes, "encoding");
+    return encoding && (!strcasecmp(encoding->value, "text/html") ||
+                        !strcasecmp(encoding->value, "application/xhtml+xml"));
+  }
+  return false;
+}
+
+static void push_element(GumboLexer* lexer, GumboTag tag,
+                         GumboNamespaceEnum tag_namespace,
+                         bool integration_point) {
+  if (lexer->_foreign_length == lexer->_foreign_capacity) {
+    lexer->_foreign_capacity = lexer->_foreign_capacity ?
+        lexer->_foreign_capacity * 2 : 8;
+    lexer->_foreign_elements = gumbo_realloc(lexer->_foreign_elements,
+        lexer->_foreign_capacity * sizeof(GumboLexerElement));
+  }
+  GumboLexerElement* element =
+      &lexer->_foreign_elements[lexer->_foreign_length++];
+  element->tag = tag;
+  element->tag_namespace = tag_namespace;
+  element->is_integration_point = integration_point;
+}
+
+static void push_foreign_element(GumboLexer* lexer, const GumboToken* token,
+                                 GumboNamespaceEnum tag_namespace) {
+  push_element(lexer, token->v.start_tag.tag, tag_namespace,
+               is_integration_point(token, tag_namespace));
+}
+
+// True if HTML rules apply to the next token: outside foreign content or
+// directly within an integration point.
+static bool in_html_content(const GumboLexer* lexer) {
+  return lexer->_foreign_length == 0 ||
+      lexer->_foreign_elements[lexer->_foreign_length - 1].is_integration_point;
+}
+
+// Switches the tokenizer state after an HTML start tag as the tree builder
+// does.
+static void handle_html_start_tag(GumboLexer* lexer, const GumboToken* token) {
+  GumboParser* parser = &lexer->_parser;
+  switch (token->v.start_tag.tag) {
+    case GUMBO_TAG_SVG:
+      if (!token->v.start_tag.is_self_closing) {
+        push_foreign_element(lexer, token, GUMBO_NAMESPACE_SVG);
+      }
+      break;
+    case GUMBO_TAG_MATH:
+      if (!token->v.start_tag.is_self_closing) {
+        push_foreign_element(lexer, token, GUMBO_NAMESPACE_MATHML);
+      }
+      break;
+    case GUMBO_TAG_TITLE:
+    case GUMBO_TAG_TEXTAREA:
+      gumbo_tokenizer_set_state(parser, GUMBO_LEX_RCDATA);
+      break;
+    case GUMBO_TAG_STYLE:
+    case GUMBO_TAG_XMP:
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_NOEMBED:
+    case GUMBO_TAG_NOFRAMES:
+      gumbo_tokenizer_set_state(parser, GUMBO_LEX_RAWTEXT);
+      break;
+    case GUMBO_TAG_SCRIPT:
+      gumbo_tokenizer_set_state(parser, GUMBO_LEX_SCRIPT);
+      break;
+    case GUMBO_TAG_PLAINTEXT:
+      gumbo_tokenizer_set_state(parser, GUMBO_LEX_PLAINTEXT);
+      break;
+    default:
+      break;
+  }
+}
+
+static void handle_foreign_start_tag(GumboLexer* lexer, const GumboToken* token) {
+  GumboTag tag = token->v.start_tag.tag;
+  if (TAGSET_INCLUDES(kBreakoutTags, tag) ||
+      (tag == GUMBO_TAG_FONT && (token_has_attribute(token, "color") ||
+                                 token_has_attribute(token, "face") ||
+                                 token_has_attribute(token, "size")))) {
+    lexer->_foreign_length = 0;
+    handle_html_start_tag(lexer, token);
+    return;
+  }
+  if (!token->v.start_tag.is_self_closing) {
+    GumboNamespaceEnum tag_namespace = tag == GUMBO_TAG_SVG ?
+        GUMBO_NAMESPACE_SVG :
+        lexer->_foreign_elements[lexer->_foreign_length - 1].tag_namespace;
+    push_foreign_element(lexer, token, tag_namespace);
+  }
+}
+
+static void handle_end_tag(GumboLexer* lexer, const GumboToken* token) {
+  GumboTag tag = token->v.end_tag;
+  if (!in_html_content(lexer) &&
+      (tag == GUMBO_TAG_BR || tag == GUMBO_TAG_P)) {
+    lexer->_foreign_length = 0;
+    return;
+  }
+  for (unsigned int i = lexer->_foreign_length; i > 0; --i) {
+    if (lexer->_foreign_elements[i - 1].tag == tag) {
+      lexer->_foreign_length = i - 1;
+      return;
+    }
+  }
+}
+
+void gumbo_lexer_init(GumboLexer* lexer, const GumboOptions* options,
+                      const char* text, size_t text_length) {
+  lexer->_parser._options = options;
+  lexer->_parser._output = &lexer->_output;
+  lexer->_parser._parser_state = NULL;
+  lexer->_output.document = NULL;
+  lexer->_output.root = NULL;
+  lexer->_output.status = GUMBO_STATUS_OK;
+  gumbo_vector_init(0, &lexer->_output.errors);
+  lexer->_foreign_elements = NULL;
+  lexer->_foreign_length = 0;
+  lexer->_foreign_capacity = 0;
+  lexer->_done = false;
+  gumbo_tokenizer_state_init(&lexer->_parser, text, text_length);
+}
+
+// Updates the foreign elements and tokenizer state after a token.
+static void predict_next_token(GumboLexer* lexer, const GumboToken* output) {
+  switch (output->type) {
+    case GUMBO_TOKEN_START_TAG:
+      if (in_html_content(lexer)) {
+        handle_html_start_tag(lexer, output);
+      } else {
+        handle_foreign_start_tag(lexer, output);
+      }
+      break;
+    case GUMBO_TOKEN_END_TAG:
+      handle_end_tag(lexer, output);
+      break;
+    case GUMBO_TOKEN_EOF:
+      lexer->_done = true;
+      break;
+    default:
+      break;
+  }
+}
+
+bool gumbo_lexer_next(GumboLexer* lexer, GumboToken* output) {
+  if (lexer->_done) {
+    return false;
+  }
+  gumbo_tokenizer_set_is_current_node_foreign(
+      &lexer->_parser, !in_html_content(lexer));
+  gumbo_lex(&lexer->_parser, output);
+  predict_next_token(lexer, output);
+  return true;
+}
+
+bool gumbo_lexer_next_lookahead(GumboLexer* lexer, GumboLookaheadToken* output) {
+  if (lexer->_done) {
+    return false;
+  }
+  GumboParser* parser = &lexer->_parser;
+  gumbo_lexer_save(lexer, &output->checkpoint);
+  output->start_state = gumbo_tokenizer_get_state(parser);
+  output->is_current_node_foreign = !in_html_content(lexer);
+  gumbo_tokenizer_set_is_current_node_foreign(
+      parser, output->is_current_node_foreign);
+
+  output->result = gumbo_lex(parser, &output->token);
+
+  output->checked_current_node_foreign =
+      gumbo_tokenizer_checked_current_node_foreign(parser);
+  output->end_state = gumbo_tokenizer_get_state(parser);
+  gumbo_tokenizer_get_token_start(
+      parser, &output->next_token_start, &output->next_token_start_pos);
+  output->errors = lexer->_output.errors;
+  gumbo_vector_init(0, &lexer->_output.errors);
+  output->truncated = lexer->_output.status == GUMBO_STATUS_TRUNCATED;
+  lexer->_output.status = GUMBO_STATUS_OK;
+  predict_next_token(lexer, &output->token);
+  return true;
+}
+
+void gumbo_lexer_set_state(GumboLexer* lexer, GumboTokenizerEnum state,
+                           bool is_current_node_foreign) {
+  gumbo_tokenizer_set_state(&lexer->_parser, state);
+  // Only whether the current node is foreign is known here, not which elements
+  // are open, so the stack is just made to agree.  Wrong predictions later on
+  // cost another restart but never a wrong token.
+  if (!is_current_node_foreign && !in_html_content(lexer)) {
+    lexer->_foreign_length = 0;
+  } else if (is_current_node_foreign && in_html_content(lexer)) {
+    // A stand-in that no end tag matches.
+    push_element(lexer, GUMBO_TAG_LAST, GUMBO_NAMESPACE_SVG, false);
+  }
+}
+
+void gumbo_lexer_restart(GumboLexer* lexer,
+                         const GumboLexerCheckpoint* checkpoint,
+                         GumboTokenizerEnum state,
+                         bool is_current_node_foreign) {
+  gumbo_tokenizer_restore(&lexer->_parser, &checkpoint->tokenizer, state);
+  // Elements above foreign_length may have been replaced since, but again
+  // that only affects the predictions.
+  if (checkpoint->foreign_length < lexer->_foreign_length) {
+    lexer->_foreign_length = checkpoint->foreign_length;
+  }
+  gumbo_lexer_set_state(lexer, state, is_current_node_foreign);
+  lexer->_done = false;
+}
+
+bool gumbo_lexer_save(const GumboLexer* lexer, GumboLexerCheckpoint* checkpoint) {
+  gumbo_tokenizer_save(&lexer->_parser, &checkpoint->tokenizer);
+  checkpoint->foreign_length = lexer->_foreign_length;
+  return checkpoint->tokenizer._is_restorable;
+}
+
+GumboTokenizerEnum gumbo_lexer_get_state(const GumboLexer* lexer) {
+  return gumbo_tokenizer_get_state(&lexer->_parser);
+}
+
+static void destroy_errors(GumboVector* errors) {
+  for (unsigned int i = 0; i < errors->length; ++i) {
+    gumbo_error_destroy(errors->data[i]);
+  }
+  errors->length = 0;
+}
+
+void gumbo_lexer_seek(GumboLexer* lexer, const char* position,
+                      const GumboSourcePosition* pos) {
+  GumboLexerCheckpoint checkpoint;
+  gumbo_lexer_save(lexer, &checkpoint);
+  GumboTokenizerCheckpoint* tokenizer = &checkpoint.tokenizer;
+  utf8iterator_seek(&tokenizer->_input, position, pos);
+  tokenizer->_token_start = position;
+  tokenizer->_token_start_pos = *pos;
+  tokenizer->_last_start_tag = GUMBO_TAG_LAST;
+  tokenizer->_reconsume_current_input = false;
+  tokenizer->_is_in_cdata = false;
+  // Whatever the tokenizer was still emitting belongs to the old position.
+  tokenizer->_is_restorable = true;
+  checkpoint.foreign_length = 0;
+  gumbo_lexer_restart(lexer, &checkpoint, GUMBO_LEX_DATA, false);
+  // Errors in the character at position (and anything before it) are reported
+  // by the lexer of the text before it.
+  destroy_errors(&lexer->_output.errors);
+  lexer->_output.status = GUMBO_STATUS_OK;
+}
+
+bool gumbo_lexer_is_at_fresh_token(const GumboLexer* lexer) {
+  GumboTokenizerCheckpoint checkpoint;
+  gumbo_tokenizer_save(&lexer->_parser, &checkpoint);
+  return checkpoint._is_restorable && !checkpoint._reconsume_current_input &&
+      !checkpoint._is_in_cdata &&
+      gumbo_tokenizer_get_state(&lexer->_parser) == GUMBO_LEX_DATA &&
+      in_html_content(lexer);
+}
+
+void gumbo_lookahead_token_destroy(GumboLookaheadToken* token) {
+  gumbo_token_destroy(&token->token);
+  for (unsigned int i = 0; i < token->errors.length; ++i) {
+    gumbo_error_destroy(token->errors.data[i]);
+  }
+  gumbo_vector_destroy(&token->errors);
+}
+
+bool gumbo_lexer_in_foreign_content(const GumboLexer* lexer) {
+  return !in_html_content(lexer);
+}
+
+void gumbo_lexer_destroy(GumboLexer* lexer) {
+  gumbo_tokenizer_state_destroy(&lexer->_parser);
+  destroy_errors(&lexer->_output.errors);
+  gumbo_vector_destroy(&lexer->_output.errors);
+  gumbo_free(lexer->_foreign_elements);
+}
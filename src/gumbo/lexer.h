@@ -0,0 +1,167 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This contains a driver that runs the tokenizer without tree construction.
+//
+// Normally the tree builder switches the tokenizer to the RCDATA, RAWTEXT,
+// script data and PLAINTEXT states after the start tags of elements like
+// <title>, <style> or <script>, and tells it whether the current node is in
+// foreign (SVG or MathML) content.  The lexer predicts both from the tokens
+// themselves: it tracks open foreign elements and HTML integration points
+// the same way the tree builder does.  This matches the tree builder for all
+// but unusual misnested markup (e.g. a <textarea> start tag inside <select>).
+// gumbo_lexer_next_lookahead also saves where each token started, so that a
+// tree builder that disagrees can restart the lexer there (see pipeline.h).
+// A lexer can also start in the middle of a document with gumbo_lexer_seek,
+// for lexing parts of it in parallel.
+
+#ifndef GUMBO_LEXER_H_
+#define GUMBO_LEXER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gumbo.h"
+#include "parser.h"
+#include "tokenizer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// An open element in foreign content.
+typedef struct {
+  GumboTag tag;
+  GumboNamespaceEnum tag_namespace;
+  // True for HTML and MathML text integration points, where HTML rules apply.
+  bool is_integration_point;
+} GumboLexerElement;
+
+typedef struct GumboInternalLexer {
+  GumboParser _parser;
+
+  // Collects tokenizer errors (up to options->max_errors).  No tree is built.
+  GumboOutput _output;
+
+  // Stack of open SVG and MathML elements, innermost last.  Empty in HTML
+  // content.
+  GumboLexerElement* _foreign_elements;
+  unsigned int _foreign_length;
+  unsigned int _foreign_capacity;
+
+  // Set after the EOF token has been returned.
+  bool _done;
+} GumboLexer;
+
+// Where the lexer was before a token, for restarting it there.
+typedef struct {
+  GumboTokenizerCheckpoint tokenizer;
+  unsigned int foreign_length;
+} GumboLexerCheckpoint;
+
+// A token lexed ahead of the tree builder by gumbo_lexer_next_lookahead,
+// together with what the tree builder needs to check the predictions of the
+// lexer and to take the place of gumbo_lex.
+typedef struct {
+  GumboToken token;
+
+  // The return value of gumbo_lex.
+  bool result;
+
+  // Tokenizer errors (GumboError*) added since the previous token.
+  GumboVector errors;
+
+  // Set if a limit of the options truncated the token.
+  bool truncated;
+
+  // The tokenizer state the token was lexed in, and the state gumbo_lex left
+  // the tokenizer in before the lexer predicted the state of the next token.
+  GumboTokenizerEnum start_state;
+  GumboTokenizerEnum end_state;
+
+  // The is_current_node_foreign flag the token was lexed with, and whether it
+  // made a difference.
+  bool is_current_node_foreign;
+  bool checked_current_node_foreign;
+
+  // The lexer before the token.  If the tree builder disagrees with
+  // start_state or is_current_node_foreign, lexing restarts from here.
+  GumboLexerCheckpoint checkpoint;
+
+  // The start of the next token.
+  const char* next_token_start;
+  GumboSourcePosition next_token_start_pos;
+} GumboLookaheadToken;
+
+// Initializes the lexer for the specified text.  The options and text must
+// outlive the lexer.
+void gumbo_lexer_init(GumboLexer* lexer, const GumboOptions* options,
+                      const char* text, size_t text_length);
+
+// Lexes the next token into output.  Returns false once the EOF token has been
+// returned, in which case output is left untouched.  Tokens must be freed with
+// gumbo_token_destroy.
+bool gumbo_lexer_next(GumboLexer* lexer, GumboToken* output);
+
+// Same as gumbo_lexer_next, but fills in a GumboLookaheadToken.  The errors
+// are moved into the output rather than collected.  Free the output with
+// gumbo_lookahead_token_destroy unless the token and errors are taken over.
+bool gumbo_lexer_next_lookahead(GumboLexer* lexer, GumboLookaheadToken* output);
+
+// Sets the tokenizer state and is_current_node_foreign flag for the next
+// token, e.g. for fragment parsing.
+void gumbo_lexer_set_state(GumboLexer* lexer, GumboTokenizerEnum state,
+                           bool is_current_node_foreign);
+
+// Restarts lexing from a checkpoint of a GumboLookaheadToken, in the state
+// and foreign content given by the tree builder.
+void gumbo_lexer_restart(GumboLexer* lexer,
+                         const GumboLexerCheckpoint* checkpoint,
+                         GumboTokenizerEnum state,
+                         bool is_current_node_foreign);
+
+// Saves where the lexer is after the last token, like the checkpoint of the
+// next one.  Returns false if lexing can't be restarted there because the
+// tokenizer is still emitting characters buffered by the last token.
+bool gumbo_lexer_save(const GumboLexer* lexer, GumboLexerCheckpoint* checkpoint);
+
+// Returns the tokenizer state the lexer predicts for the next token.
+GumboTokenizerEnum gumbo_lexer_get_state(const GumboLexer* lexer);
+
+// Starts lexing afresh at position, in the data state, in HTML content and
+// with nothing carried over from the text before it.  pos is the source
+// position of position, which must be the start of a code point.  This lets
+// several lexers work on parts of one document (see
+// gumbo_lexer_is_at_fresh_token).
+void gumbo_lexer_seek(GumboLexer* lexer, const char* position,
+                      const GumboSourcePosition* pos);
+
+// Returns true if a lexer seeked to the start of the next token would lex the
+// same tokens as this one: the next token is lexed in the data state and in
+// HTML content, and nothing is buffered or to be reconsumed.
+bool gumbo_lexer_is_at_fresh_token(const GumboLexer* lexer);
+
+// Frees the token and errors of a GumboLookaheadToken.
+void gumbo_lookahead_token_destroy(GumboLookaheadToken* token);
+
+// Returns true if the next token will be lexed in foreign content, i.e. inside
+// an SVG or MathML element and not directly within an integration point.
+bool gumbo_lexer_in_foreign_content(const GumboLexer* lexer);
+
+// Frees the tokenizer state and collected errors.
+void gumbo_lexer_destroy(GumboLexer* lexer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUMBO_LEXER_H_
@@ -25,6 +25,7 @@
 #include "gumbo.h"
 #include "insertion_mode.h"
 #include "parser.h"
+#include "pipeline.h"
 #include "tokenizer.h"
 #include "tokenizer_states.h"
 #include "utf8.h"
@@ -58,6 +59,24 @@ const GumboOptions kGumboDefaultOptions = {
   true,
   false,
   50,
+  NULL,
+  NULL,
+  GUMBO_TAG_LAST,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  false,
+  false,
+  -1,
+  -1,
+  -1,
+  -1,
+  -1,
+  NULL,
+  NULL,
+  1024,
+  true,
 };
 
 static const GumboStringPiece kDoctypeHtml = GUMBO_STRING("html");
@@ -398,6 +417,22 @@ typedef struct GumboInternalParserState {
   // The current token.
   GumboToken* _current_token;
 
+  // The status of the output once parsing stops after the current token, e.g.
+  // when an element named by the stop_after option has been closed.
+  // GUMBO_STATUS_OK while parsing goes on.
+  GumboOutputStatus _stop_status;
+
+  // The number of nodes inserted so far, for the max_nodes option.
+  int _node_count;
+
+  // The number of open elements with a tag listed in the prune_tags option,
+  // so that checking for pruned content is free when there are none.
+  unsigned int _pruned_depth;
+
+  // Elements with a tag listed in the evict_tags option that have been closed
+  // while processing the current token, to be freed after it.
+  GumboVector /*GumboNode*/ _evicted_elements;
+
   // The way that the spec is written, the </body> and </html> tags are *always*
   // implicit, because encountering one of those tokens merely switches the
   // insertion mode out of "in body".  So we have individual state flags for
@@ -479,43 +514,68 @@ static void output_init(GumboParser* parser) {
   GumboOutput* output = gumbo_malloc(sizeof(GumboOutput));
   output->root = NULL;
   output->document = new_document_node();
+  output->status = GUMBO_STATUS_OK;
   parser->_output = output;
   gumbo_init_errors(parser);
 }
 
-static void parser_state_init(GumboParser* parser) {
-  GumboParserState* parser_state =
-      gumbo_malloc(sizeof(GumboParserState));
+// Initializes the parser state, reusing the one detached from an earlier parse
+// by parser_state_detach if recycled is non-NULL.
+static void parser_state_init(
+    GumboParser* parser, GumboParserState* recycled) {
+  GumboParserState* parser_state = recycled;
+  if (recycled) {
+    gumbo_string_buffer_clear(&parser_state->_text_node._buffer);
+    parser_state->_open_elements.length = 0;
+    parser_state->_active_formatting_elements.length = 0;
+    parser_state->_template_insertion_modes.length = 0;
+    parser_state->_evicted_elements.length = 0;
+  } else {
+    parser_state = gumbo_malloc(sizeof(GumboParserState));
+    gumbo_string_buffer_init(&parser_state->_text_node._buffer);
+    gumbo_vector_init(10, &parser_state->_open_elements);
+    gumbo_vector_init(5, &parser_state->_active_formatting_elements);
+    gumbo_vector_init(5, &parser_state->_template_insertion_modes);
+    gumbo_vector_init(0, &parser_state->_evicted_elements);
+  }
   parser_state->_insertion_mode = GUMBO_INSERTION_MODE_INITIAL;
   parser_state->_reprocess_current_token = false;
   parser_state->_frameset_ok = true;
   parser_state->_ignore_next_linefeed = false;
   parser_state->_foster_parent_insertions = false;
   parser_state->_text_node._type = GUMBO_NODE_WHITESPACE;
-  gumbo_string_buffer_init(&parser_state->_text_node._buffer);
-  gumbo_vector_init(10, &parser_state->_open_elements);
-  gumbo_vector_init(5, &parser_state->_active_formatting_elements);
-  gumbo_vector_init(5, &parser_state->_template_insertion_modes);
   parser_state->_head_element = NULL;
   parser_state->_form_element = NULL;
   parser_state->_fragment_ctx = NULL;
   parser_state->_current_token = NULL;
   parser_state->_closed_body_tag = false;
   parser_state->_closed_html_tag = false;
+  parser_state->_stop_status = GUMBO_STATUS_OK;
+  parser_state->_node_count = 0;
+  parser_state->_pruned_depth = 0;
   parser->_parser_state = parser_state;
 }
 
-static void parser_state_destroy(GumboParser* parser) {
+// Detaches the parser state at the end of a parse and returns it, keeping its
+// buffers for parser_state_init.
+static GumboParserState* parser_state_detach(GumboParser* parser) {
   GumboParserState* state = parser->_parser_state;
   if (state->_fragment_ctx) {
     free_node(state->_fragment_ctx);
+    state->_fragment_ctx = NULL;
   }
+  parser->_parser_state = NULL;
+  return state;
+}
+
+static void parser_state_destroy(GumboParser* parser) {
+  GumboParserState* state = parser_state_detach(parser);
   gumbo_vector_destroy(&state->_active_formatting_elements);
   gumbo_vector_destroy(&state->_open_elements);
   gumbo_vector_destroy(&state->_template_insertion_modes);
+  gumbo_vector_destroy(&state->_evicted_elements);
   gumbo_string_buffer_destroy(&state->_text_node._buffer);
   gumbo_free(state);
-  parser->_parser_state = NULL;
 }
 
 static GumboNode* get_document_node(GumboParser* parser) {
@@ -882,6 +942,68 @@ static void insert_node(GumboNode* node, InsertionLocation location) {
 }
 
 
+static void request_stop(GumboParser* parser, GumboOutputStatus status) {
+  GumboParserState* state = parser->_parser_state;
+  if (state->_stop_status == GUMBO_STATUS_OK) {
+    state->_stop_status = status;
+  }
+}
+
+// Counts a node inserted into the tree against the max_nodes option.
+static void count_node(GumboParser* parser) {
+  int max_nodes = parser->_options->max_nodes;
+  if (++parser->_parser_state->_node_count > max_nodes && max_nodes >= 0) {
+    request_stop(parser, GUMBO_STATUS_TOO_MANY_NODES);
+  }
+}
+
+static void mark_truncated(GumboParser* parser) {
+  if (parser->_output->status == GUMBO_STATUS_OK) {
+    parser->_output->status = GUMBO_STATUS_TRUNCATED;
+  }
+}
+
+// Elements that may be separated by whitespace that renders as a space.
+static const gumbo_tagset kPhrasingTags = { TAG(A), TAG(ABBR), TAG(ACRONYM),
+  TAG(AUDIO), TAG(B), TAG(BDI), TAG(BDO), TAG(BIG), TAG(BR), TAG(BUTTON),
+  TAG(CANVAS), TAG(CITE), TAG(CODE), TAG(DATA), TAG(DEL), TAG(DFN), TAG(EM),
+  TAG(EMBED), TAG(FONT), TAG(I), TAG(IFRAME), TAG(IMG), TAG(INPUT), TAG(INS),
+  TAG(KBD), TAG(LABEL), TAG(MAP), TAG(MARK), TAG(METER), TAG(NOBR),
+  TAG(OBJECT), TAG(OUTPUT), TAG(PROGRESS), TAG(Q), TAG(RUBY), TAG(S),
+  TAG(SAMP), TAG(SELECT), TAG(SMALL), TAG(SPAN), TAG(STRIKE), TAG(STRONG),
+  TAG(SUB), TAG(SUP), TAG(TEXTAREA), TAG(TIME), TAG(TT), TAG(U), TAG(VAR),
+  TAG(VIDEO), TAG(WBR), TAG_SVG(SVG), TAG_MATHML(MATH) };
+
+// Whitespace that drop_whitespace keeps: the content of preformatted elements,
+// and whitespace between two pieces of phrasing content, such as the space in
+// <b>a</b> <i>b</i>.  The next piece is the start tag being processed, since
+// text after the whitespace would have been buffered with it.
+static bool is_significant_whitespace(
+    const GumboParser* parser, InsertionLocation location) {
+  for (const GumboNode* node = location.target; node; node = node->parent) {
+    if (node_tag_in_set(node, (gumbo_tagset) { TAG(PRE), TAG(TEXTAREA),
+        TAG(LISTING), TAG(PLAINTEXT) })) {
+      return true;
+    }
+  }
+  const GumboToken* token = parser->_parser_state->_current_token;
+  if (location.target->type == GUMBO_NODE_DOCUMENT ||
+      token->type != GUMBO_TOKEN_START_TAG ||
+      !(TAGSET_INCLUDES(kPhrasingTags, GUMBO_NAMESPACE_HTML, token->v.start_tag.tag) ||
+        token->v.start_tag.tag == GUMBO_TAG_SVG ||
+        token->v.start_tag.tag == GUMBO_TAG_MATH)) {
+    return false;
+  }
+  const GumboVector* children = &location.target->v.element.children;
+  size_t index = location.index == -1 ? children->length : (size_t) location.index;
+  if (index == 0) {
+    return false;
+  }
+  const GumboNode* previous = children->data[index - 1];
+  return previous->type == GUMBO_NODE_TEXT || previous->type == GUMBO_NODE_CDATA ||
+      node_tag_in_set(previous, kPhrasingTags);
+}
+
 static void maybe_flush_text_node_buffer(GumboParser* parser) {
   GumboParserState* state = parser->_parser_state;
   TextNodeBufferState* buffer_state = &state->_text_node;
@@ -892,6 +1014,13 @@ static void maybe_flush_text_node_buffer(GumboParser* parser) {
   assert(buffer_state->_type == GUMBO_NODE_WHITESPACE ||
          buffer_state->_type == GUMBO_NODE_TEXT ||
          buffer_state->_type == GUMBO_NODE_CDATA);
+  InsertionLocation location = get_appropriate_insertion_location(parser, NULL);
+  if (buffer_state->_type == GUMBO_NODE_WHITESPACE &&
+      parser->_options->drop_whitespace &&
+      !is_significant_whitespace(parser, location)) {
+    gumbo_string_buffer_clear(&buffer_state->_buffer);
+    return;
+  }
   GumboNode* text_node = create_node(buffer_state->_type);
   GumboText* text_node_data = &text_node->v.text;
   text_node_data->text = gumbo_string_buffer_to_string(&buffer_state->_buffer);
@@ -904,13 +1033,13 @@ static void maybe_flush_text_node_buffer(GumboParser* parser) {
   gumbo_debug("Flushing text node buffer of %.*s.\n",
              (int) buffer_state->_buffer.length, buffer_state->_buffer.data);
 
-  InsertionLocation location = get_appropriate_insertion_location(parser, NULL);
   if (location.target->type == GUMBO_NODE_DOCUMENT) {
     // The DOM does not allow Document nodes to have Text children, so per the
     // spec, they are dropped on the floor.
     free_node(text_node);
   } else {
     insert_node(text_node, location);
+    count_node(parser);
   }
 
   gumbo_string_buffer_clear(&buffer_state->_buffer);
@@ -918,6 +1047,201 @@ static void maybe_flush_text_node_buffer(GumboParser* parser) {
   assert(buffer_state->_buffer.length == 0);
 }
 
+// Only HTML elements and the svg and math roots of foreign content are pruned,
+// so that pruning title keeps the title of an SVG image.
+static bool is_pruned_element(const GumboParser* parser, const GumboNode* node) {
+  const bool* prune_tags = parser->_options->prune_tags;
+  GumboTag tag = node->v.element.tag;
+  if (!prune_tags || tag >= GUMBO_TAG_LAST || !prune_tags[tag]) {
+    return false;
+  }
+  return node->v.element.tag_namespace == GUMBO_NAMESPACE_HTML ||
+      node_qualified_tag_is(node, GUMBO_NAMESPACE_SVG, GUMBO_TAG_SVG) ||
+      node_qualified_tag_is(node, GUMBO_NAMESPACE_MATHML, GUMBO_TAG_MATH);
+}
+
+// True if node is a pruned element or inside one.
+static bool is_pruned_content(const GumboParser* parser, const GumboNode* node) {
+  if (parser->_parser_state->_pruned_depth == 0) {
+    return false;
+  }
+  for (; node; node = node->parent) {
+    if (node->parse_flags & GUMBO_INSERTION_CONTENT_PRUNED) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool is_descendant_of(const GumboNode* node, const GumboNode* ancestor) {
+  for (; node; node = node->parent) {
+    if (node->parent == ancestor) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// True if the parser state still refers to an element inside the given one,
+// so its children can't be freed yet.
+static bool has_referenced_descendants(
+    const GumboParser* parser, const GumboNode* node) {
+  const GumboParserState* state = parser->_parser_state;
+  if (is_descendant_of(state->_form_element, node) ||
+      is_descendant_of(state->_head_element, node)) {
+    return true;
+  }
+  for (unsigned int i = 0; i < state->_open_elements.length; ++i) {
+    if (is_descendant_of(state->_open_elements.data[i], node)) {
+      return true;
+    }
+  }
+  const GumboVector* formatting = &state->_active_formatting_elements;
+  for (unsigned int i = 0; i < formatting->length; ++i) {
+    const GumboNode* element = formatting->data[i];
+    if (element != &kActiveFormattingScopeMarker &&
+        is_descendant_of(element, node)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Takes the element and the elements inside it off the list of closed
+// elements to evict, before the parser frees them itself.
+static void forget_evicted_elements(GumboParser* parser, const GumboNode* node) {
+  GumboVector* closed = &parser->_parser_state->_evicted_elements;
+  size_t kept = 0;
+  for (size_t i = 0; i < closed->length; ++i) {
+    GumboNode* element = closed->data[i];
+    if (element != node && !is_descendant_of(element, node)) {
+      closed->data[kept++] = element;
+    }
+  }
+  closed->length = kept;
+}
+
+// Frees the elements left inside a pruned element when it is closed.  They
+// are still created while it is open, because the tree construction rules
+// depend on the stack of open elements, but without text or attributes.
+static void free_pruned_content(GumboParser* parser, GumboNode* node) {
+  GumboVector* children = &node->v.element.children;
+  if (children->length == 0 || has_referenced_descendants(parser, node)) {
+    return;
+  }
+  forget_evicted_elements(parser, node);
+  for (unsigned int i = 0; i < children->length; ++i) {
+    free_node(children->data[i]);
+  }
+  children->length = 0;
+}
+
+static bool is_evicted_element(const GumboParser* parser, const GumboNode* node) {
+  const bool* evict_tags = parser->_options->evict_tags;
+  return evict_tags && node->v.element.tag < GUMBO_TAG_LAST &&
+      evict_tags[node->v.element.tag];
+}
+
+// True if the parser state still refers to the element or an element inside
+// it.
+static bool is_referenced(const GumboParser* parser, const GumboNode* node) {
+  const GumboParserState* state = parser->_parser_state;
+  if (node == state->_form_element || node == state->_head_element) {
+    return true;
+  }
+  const GumboVector* formatting = &state->_active_formatting_elements;
+  for (unsigned int i = 0; i < formatting->length; ++i) {
+    if (formatting->data[i] == node) {
+      return true;
+    }
+  }
+  return has_referenced_descendants(parser, node);
+}
+
+// Frees the elements of the evict_tags option that have been closed while
+// processing the current token.  All of them are detached from the tree
+// before any is freed, since one may be inside another.
+static void evict_closed_elements(GumboParser* parser) {
+  GumboVector* closed = &parser->_parser_state->_evicted_elements;
+  size_t evicted = 0;
+  for (size_t i = 0; i < closed->length; ++i) {
+    GumboNode* node = closed->data[i];
+    GumboNode* parent = node->parent;
+    if (!parent || parent->type == GUMBO_NODE_DOCUMENT ||
+        is_referenced(parser, node)) {
+      continue;
+    }
+    GumboVector* children = &parent->v.element.children;
+    size_t index = node->index_within_parent;
+    if (index >= children->length || children->data[index] != node) {
+      // Removing the body for a frameset leaves later siblings unrenumbered.
+      index = gumbo_vector_index_of(children, node);
+    }
+    gumbo_vector_remove_at(index, children);
+    for (size_t j = index; j < children->length; ++j) {
+      GumboNode* sibling = children->data[j];
+      sibling->index_within_parent = j;
+    }
+    node->parent = NULL;
+    node->index_within_parent = -1;
+    closed->data[evicted++] = node;
+  }
+  for (size_t i = 0; i < evicted; ++i) {
+    free_node(closed->data[i]);
+  }
+  closed->length = 0;
+}
+
+static void notify_element_start(GumboParser* parser, GumboNode* node) {
+  const GumboOptions* options = parser->_options;
+  GumboParserState* state = parser->_parser_state;
+  // The encoding attribute of annotation-xml decides whether it is an HTML
+  // integration point, so it is the only element that keeps its attributes.
+  if (is_pruned_content(parser, node->parent) &&
+      !node_qualified_tag_is(node, GUMBO_NAMESPACE_MATHML,
+                             GUMBO_TAG_ANNOTATION_XML)) {
+    GumboVector* attributes = &node->v.element.attributes;
+    for (unsigned int i = 0; i < attributes->length; ++i) {
+      gumbo_destroy_attribute(attributes->data[i]);
+    }
+    attributes->length = 0;
+  }
+  if (is_pruned_element(parser, node)) {
+    node->parse_flags |= GUMBO_INSERTION_CONTENT_PRUNED;
+    ++state->_pruned_depth;
+  }
+  count_node(parser);
+  // Elements past max_tree_depth are normally flattened before they get here
+  // (see flatten_at_max_tree_depth), so this only stops the parse when the
+  // current node could not be closed to make room.
+  if (options->max_tree_depth >= 0 &&
+      state->_open_elements.length > (unsigned int) options->max_tree_depth) {
+    request_stop(parser, GUMBO_STATUS_TREE_TOO_DEEP);
+  }
+  if (options->element_start) {
+    options->element_start(options->userdata, node);
+  }
+}
+
+static void notify_element_end(GumboParser* parser, GumboNode* node) {
+  const GumboOptions* options = parser->_options;
+  if (is_pruned_element(parser, node)) {
+    assert(parser->_parser_state->_pruned_depth > 0);
+    --parser->_parser_state->_pruned_depth;
+    free_pruned_content(parser, node);
+  }
+  if (options->stop_after != GUMBO_TAG_LAST &&
+      node_html_tag_is(node, options->stop_after)) {
+    request_stop(parser, GUMBO_STATUS_STOPPED);
+  }
+  if (options->element_end) {
+    options->element_end(options->userdata, node);
+  }
+  if (is_evicted_element(parser, node)) {
+    gumbo_vector_add(node, &parser->_parser_state->_evicted_elements);
+  }
+}
+
 static void record_end_of_element(
     GumboToken* current_token, GumboElement* element) {
   element->end_pos = current_token->position;
@@ -952,12 +1276,17 @@ static GumboNode* pop_current_node(GumboParser* parser) {
   if (!is_closed_body_or_html_tag) {
     record_end_of_element(state->_current_token, &current_node->v.element);
   }
+  notify_element_end(parser, current_node);
   return current_node;
 }
 
 static void append_comment_node(
     GumboParser* parser, GumboNode* node, const GumboToken* token) {
   maybe_flush_text_node_buffer(parser);
+  if (parser->_options->drop_comments || is_pruned_content(parser, node)) {
+    gumbo_free((void*) token->v.text);
+    return;
+  }
   GumboNode* comment = create_node(GUMBO_NODE_COMMENT);
   comment->type = GUMBO_NODE_COMMENT;
   comment->parse_flags = GUMBO_INSERTION_NORMAL;
@@ -965,6 +1294,7 @@ static void append_comment_node(
   comment->v.text.original_text = token->original_text;
   comment->v.text.start_pos = token->position;
   append_node(node, comment);
+  count_node(parser);
 }
 
 // http://www.whatwg.org/specs/web-apps/current-work/complete/tokenization.html#clear-the-stack-back-to-a-table-row-context
@@ -1038,6 +1368,38 @@ static GumboNode* create_element_from_token(GumboParser *parser,
 }
 
 // http://www.whatwg.org/specs/web-apps/current-work/complete/tokenization.html#insert-an-html-element
+// Elements that the insertion modes expect to stay open until their end tag
+// or an explicit reset, so they are never closed to enforce max_tree_depth.
+static const gumbo_tagset kDepthAnchorTags = { TAG(HTML), TAG(HEAD),
+  TAG(BODY), TAG(FRAMESET), TAG(TEMPLATE), TAG(TABLE), TAG(CAPTION),
+  TAG(COLGROUP), TAG(TBODY), TAG(THEAD), TAG(TFOOT), TAG(TR), TAG(TD),
+  TAG(TH), TAG(SELECT) };
+
+static bool is_at_max_tree_depth(const GumboParser* parser) {
+  int max_depth = parser->_options->max_tree_depth;
+  return max_depth >= 0 && parser->_parser_state->_open_elements.length > 0 &&
+      parser->_parser_state->_open_elements.length >= (unsigned int) max_depth;
+}
+
+static void mark_tree_too_deep(GumboParser* parser) {
+  if (parser->_output->status == GUMBO_STATUS_OK) {
+    parser->_output->status = GUMBO_STATUS_TREE_TOO_DEEP;
+  }
+}
+
+// Makes room on the stack of open elements for an element that would be
+// nested deeper than max_tree_depth allows, by closing the current node so
+// that the new element becomes its sibling.  The rest of the document is
+// still parsed.
+static void flatten_at_max_tree_depth(GumboParser* parser) {
+  if (!is_at_max_tree_depth(parser) ||
+      node_tag_in_set(get_current_node(parser), kDepthAnchorTags)) {
+    return;
+  }
+  pop_current_node(parser);
+  mark_tree_too_deep(parser);
+}
+
 static void insert_element(GumboParser* parser, GumboNode* node,
                            bool is_reconstructing_formatting_elements) {
   GumboParserState* state = parser->_parser_state;
@@ -1053,10 +1415,12 @@ static void insert_element(GumboParser* parser, GumboNode* node,
   if (!is_reconstructing_formatting_elements) {
     maybe_flush_text_node_buffer(parser);
   }
+  flatten_at_max_tree_depth(parser);
   InsertionLocation location =
     get_appropriate_insertion_location(parser, NULL);
   insert_node(node, location);
   gumbo_vector_add((void*) node, &state->_open_elements);
+  notify_element_start(parser, node);
 }
 
 // Convenience method that combines create_element_from_token and
@@ -1114,14 +1478,25 @@ static void insert_text_token(GumboParser* parser, GumboToken* token) {
          token->type == GUMBO_TOKEN_CHARACTER ||
          token->type == GUMBO_TOKEN_NULL ||
          token->type == GUMBO_TOKEN_CDATA);
+  if (parser->_parser_state->_pruned_depth > 0 &&
+      is_pruned_content(parser, get_current_node(parser))) {
+    // Foster-parented text goes next to the current table, so it is pruned
+    // together with the table.
+    return;
+  }
   TextNodeBufferState* buffer_state = &parser->_parser_state->_text_node;
   if (buffer_state->_buffer.length == 0) {
     // Initialize position fields.
     buffer_state->_start_original_text = token->original_text.data;
     buffer_state->_start_position = token->position;
   }
-  gumbo_string_buffer_append_codepoint(
-      token->v.character, &buffer_state->_buffer);
+  ptrdiff_t max_length = parser->_options->max_text_length;
+  if (max_length >= 0 && buffer_state->_buffer.length >= (size_t) max_length) {
+    mark_truncated(parser);
+  } else {
+    gumbo_string_buffer_append_codepoint(
+        token->v.character, &buffer_state->_buffer);
+  }
   if (token->type == GUMBO_TOKEN_CHARACTER) {
     buffer_state->_type = GUMBO_NODE_TEXT;
   } else if (token->type == GUMBO_TOKEN_CDATA) {
@@ -1293,12 +1668,19 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
     assert(i < elements->length);
     element = elements->data[i];
     assert(element != &kActiveFormattingScopeMarker);
+    if (is_at_max_tree_depth(parser)) {
+      // Flattening the clones would only pile them up as siblings on every
+      // character token, so formatting is not reconstructed this deep.
+      mark_tree_too_deep(parser);
+      return;
+    }
     GumboNode* clone = clone_node(
         element, GUMBO_INSERTION_RECONSTRUCTED_FORMATTING_ELEMENT);
     // Step 9.
     InsertionLocation location = get_appropriate_insertion_location(parser, NULL);
     insert_node(clone, location);
     gumbo_vector_add((void*) clone, &parser->_parser_state->_open_elements);
+    notify_element_start(parser, clone);
 
     // Step 10.
     elements->data[i] = clone;
@@ -1929,6 +2311,7 @@ static bool adoption_agency_algorithm(GumboParser* parser, GumboToken* token, Gu
       if (formatting_index == -1) {
         // Step 13.6.
         gumbo_vector_remove_at(node_index, &state->_open_elements);
+        notify_element_end(parser, node);
         continue;
       }
       // Step 13.7.
@@ -1938,7 +2321,9 @@ static bool adoption_agency_algorithm(GumboParser* parser, GumboToken* token, Gu
       assert(formatting_index >= 0);
       state->_active_formatting_elements.data[formatting_index] = node;
       assert(node_index >= 0);
+      notify_element_end(parser, state->_open_elements.data[node_index]);
       state->_open_elements.data[node_index] = node;
+      notify_element_start(parser, node);
       // Step 13.8.
       if (last_node == furthest_block) {
         bookmark = formatting_index + 1;
@@ -2008,11 +2393,13 @@ static bool adoption_agency_algorithm(GumboParser* parser, GumboToken* token, Gu
 
     // Step 19.
     gumbo_vector_remove(formatting_node, &state->_open_elements);
+    notify_element_end(parser, formatting_node);
     int insert_at = gumbo_vector_index_of(
                                           &state->_open_elements, furthest_block) + 1;
     assert(insert_at >= 0);
     assert((unsigned int) insert_at <= state->_open_elements.length);
     gumbo_vector_insert_at(new_formatting_node, insert_at, &state->_open_elements);
+    notify_element_start(parser, new_formatting_node);
   } // Step 20.
   return true;
 }
@@ -2465,6 +2852,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
         break;
       }
     }
+    forget_evicted_elements(parser, body_node);
     free_node(body_node);
 
     // Insert the <frameset>, and switch the insertion mode.
@@ -2605,7 +2993,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
       return success;
     } else {
       bool result = true;
-      const GumboNode* node = state->_form_element;
+      GumboNode* node = state->_form_element;
       assert(!node || node->type == GUMBO_NODE_ELEMENT);
       state->_form_element = NULL;
       if (!node || !has_node_in_scope(parser, node)) {
@@ -2626,6 +3014,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
       int index = gumbo_vector_index_of(open_elements, node);
       assert(index >= 0);
       gumbo_vector_remove_at(index, open_elements);
+      notify_element_end(parser, node);
       return result;
     }
   } else if (tag_is(token, kEndTag, GUMBO_TAG_P)) {
@@ -2695,8 +3084,10 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
       if (find_last_anchor_index(parser, &last_a)) {
         void* last_element = gumbo_vector_remove_at(
             last_a, &state->_active_formatting_elements);
-        gumbo_vector_remove(
-            last_element, &state->_open_elements);
+        if (gumbo_vector_index_of(&state->_open_elements, last_element) != -1) {
+          gumbo_vector_remove(last_element, &state->_open_elements);
+          notify_element_end(parser, last_element);
+        }
       }
       success = false;
     }
@@ -2825,8 +3216,8 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
                                GUMBO_INSERTION_FROM_ISINDEX);
     pop_current_node(parser);   // <hr>
 
-    insert_element_of_tag_type(parser, GUMBO_TAG_LABEL,
-                               GUMBO_INSERTION_FROM_ISINDEX);
+    GumboNode* label = insert_element_of_tag_type(
+        parser, GUMBO_TAG_LABEL, GUMBO_INSERTION_FROM_ISINDEX);
     TextNodeBufferState* text_state = &parser->_parser_state->_text_node;
     text_state->_start_original_text = token->original_text.data;
     text_state->_start_position = token->position;
@@ -2882,11 +3273,17 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     gumbo_vector_add(name, &input->v.element.attributes);
 
     pop_current_node(parser);   // <input>
-    pop_current_node(parser);   // <label>
+    // The label and the form may already have been closed to keep the tree
+    // within max_tree_depth.
+    if (get_current_node(parser) == label) {
+      pop_current_node(parser);
+    }
     insert_element_of_tag_type(
         parser, GUMBO_TAG_HR, GUMBO_INSERTION_FROM_ISINDEX);
     pop_current_node(parser);   // <hr>
-    pop_current_node(parser);   // <form>
+    if (get_current_node(parser) == form) {
+      pop_current_node(parser);
+    }
     if (!has_open_element(parser, GUMBO_TAG_TEMPLATE)) {
       parser->_parser_state->_form_element = NULL;
     }
@@ -4059,6 +4456,39 @@ static void fragment_parser_init(
   reset_insertion_mode_appropriately(parser);
 }
 
+static bool should_stop_parsing(
+    GumboParser* parser, const GumboToken* token, int loop_count) {
+  const GumboOptions* options = parser->_options;
+  GumboParserState* state = parser->_parser_state;
+  size_t offset = token->position.offset + token->original_text.length;
+  if (state->_stop_status == GUMBO_STATUS_OK && options->should_stop &&
+      options->should_stop(options->userdata, offset)) {
+    request_stop(parser, GUMBO_STATUS_STOPPED);
+  }
+  if (state->_stop_status == GUMBO_STATUS_OK && options->is_cancelled &&
+      (options->cancel_check_interval <= 1 ||
+       loop_count % options->cancel_check_interval == 0) &&
+      options->is_cancelled(options->cancel_userdata, offset)) {
+    request_stop(parser, GUMBO_STATUS_CANCELLED);
+  }
+  return state->_stop_status != GUMBO_STATUS_OK;
+}
+
+// Completes the tree as if the input ended after the current token.  The
+// token is replaced with an EOF token, which has to stay alive until
+// finish_parsing.
+static void stop_parsing(GumboParser* parser, GumboToken* token) {
+  GumboParserState* state = parser->_parser_state;
+  gumbo_tokenizer_make_eof_token(parser, token);
+  state->_current_token = token;
+  do {
+    state->_reprocess_current_token = false;
+    handle_token(parser, token);
+  } while (state->_reprocess_current_token);
+  evict_closed_elements(parser);
+  parser->_output->status = state->_stop_status;
+}
+
 GumboOutput* gumbo_parse(const char* buffer) {
   return gumbo_parse_with_options(
       &kGumboDefaultOptions, buffer, strlen(buffer));
@@ -4070,23 +4500,92 @@ GumboOutput* gumbo_parse_with_options(
       options, buffer, length, GUMBO_TAG_LAST, GUMBO_NAMESPACE_HTML);
 }
 
-GumboOutput* gumbo_parse_fragment(
-    const GumboOptions* options, const char* buffer, size_t length,
-    const GumboTag fragment_ctx, const GumboNamespaceEnum fragment_namespace) {
+struct GumboInternalParserHandle {
+  // The state kept from the last parse, NULL before the first one.
+  GumboParserState* _parser_state;
+  struct GumboInternalTokenizerState* _tokenizer_state;
+};
+
+// Takes the next token from the pipeline in place of gumbo_lex.  The tokenizer
+// of the parser doesn't lex; it only keeps the state that the tree builder
+// sets and the start of the next token for stop_parsing.
+static bool lex_pipelined(GumboParser* parser,
+    const GumboTokenPipeline* pipeline, bool is_current_node_foreign,
+    GumboToken* output) {
+  GumboTokenizerEnum state = gumbo_tokenizer_get_state(parser);
+  GumboLookaheadToken lookahead;
+  pipeline->next(pipeline->userdata, &lookahead);
+  while (lookahead.start_state != state ||
+         (lookahead.checked_current_node_foreign &&
+          lookahead.is_current_node_foreign != is_current_node_foreign)) {
+    gumbo_debug("Restarting the lexer at offset %zu in state %d.\n",
+        lookahead.token.position.offset, state);
+    pipeline->restart(pipeline->userdata, &lookahead.checkpoint, state,
+                      is_current_node_foreign);
+    gumbo_lookahead_token_destroy(&lookahead);
+    pipeline->next(pipeline->userdata, &lookahead);
+  }
+
+  // The lexer hands over the errors of one token at a time, so max_errors is
+  // applied here.
+  GumboOutput* parser_output = parser->_output;
+  int max_errors = parser->_options->max_errors;
+  for (unsigned int i = 0; i < lookahead.errors.length; ++i) {
+    if (max_errors < 0 ||
+        parser_output->errors.length < (unsigned int) max_errors) {
+      gumbo_vector_add(lookahead.errors.data[i], &parser_output->errors);
+    } else {
+      gumbo_error_destroy(lookahead.errors.data[i]);
+    }
+  }
+  gumbo_vector_destroy(&lookahead.errors);
+  if (lookahead.truncated && parser_output->status == GUMBO_STATUS_OK) {
+    parser_output->status = GUMBO_STATUS_TRUNCATED;
+  }
+
+  gumbo_tokenizer_set_state(parser, lookahead.end_state);
+  gumbo_tokenizer_set_token_start(
+      parser, lookahead.next_token_start, &lookahead.next_token_start_pos);
+  *output = lookahead.token;
+  return lookahead.result;
+}
+
+// Parses with the state kept by handle, or with a new state if handle is NULL.
+// The tokens come from pipeline if it is not NULL.
+static GumboOutput* parse_fragment(
+    GumboParserHandle* handle, const GumboOptions* options,
+    const char* buffer, size_t length, const GumboTag fragment_ctx,
+    const GumboNamespaceEnum fragment_namespace,
+    const GumboTokenPipeline* pipeline) {
   GumboParser parser;
   parser._options = options;
-  parser_state_init(&parser);
+  parser_state_init(&parser, handle ? handle->_parser_state : NULL);
   // Must come after parser_state_init, since creating the document node must
   // reference parser_state->_current_node.
   output_init(&parser);
   // And this must come after output_init, because initializing the tokenizer
   // reads the first character and that may cause a UTF-8 decode error
-  // (inserting into output->errors) if that's invalid.
-  gumbo_tokenizer_state_init(&parser, buffer, length);
+  // (inserting into output->errors) if that's invalid.  With a pipeline the
+  // lexer reads the text, so the tokenizer gets none of it.
+  size_t tokenizer_length = pipeline ? 0 : length;
+  if (handle && handle->_tokenizer_state) {
+    gumbo_tokenizer_state_reuse(
+        &parser, handle->_tokenizer_state, buffer, tokenizer_length);
+  } else {
+    gumbo_tokenizer_state_init(&parser, buffer, tokenizer_length);
+  }
+  if (handle) {
+    // The parser owns the state until the parse is done.
+    handle->_parser_state = NULL;
+    handle->_tokenizer_state = NULL;
+  }
 
   if (fragment_ctx != GUMBO_TAG_LAST) {
     fragment_parser_init(&parser, fragment_ctx, fragment_namespace);
   }
+  if (pipeline) {
+    pipeline->start(pipeline->userdata, gumbo_tokenizer_get_state(&parser));
+  }
 
   GumboParserState* state = parser._parser_state;
   gumbo_debug("Parsing %.*s.\n", length, buffer);
@@ -4107,10 +4606,16 @@ GumboOutput* gumbo_parse_fragment(
       state->_reprocess_current_token = false;
     } else {
       GumboNode* current_node = get_current_node(&parser);
-      gumbo_tokenizer_set_is_current_node_foreign(
-          &parser, current_node &&
-          current_node->v.element.tag_namespace != GUMBO_NAMESPACE_HTML);
-      has_error = !gumbo_lex(&parser, &token) || has_error;
+      bool is_current_node_foreign = current_node &&
+          current_node->v.element.tag_namespace != GUMBO_NAMESPACE_HTML;
+      if (pipeline) {
+        has_error = !lex_pipelined(
+            &parser, pipeline, is_current_node_foreign, &token) || has_error;
+      } else {
+        gumbo_tokenizer_set_is_current_node_foreign(
+            &parser, is_current_node_foreign);
+        has_error = !gumbo_lex(&parser, &token) || has_error;
+      }
     }
     const char* token_type = "text";
     switch (token.type) {
@@ -4190,13 +4695,25 @@ GumboOutput* gumbo_parse_fragment(
       }
     }
 
+    evict_closed_elements(&parser);
+
+    if (token.type != GUMBO_TOKEN_EOF && !state->_reprocess_current_token &&
+        should_stop_parsing(&parser, &token, loop_count)) {
+      stop_parsing(&parser, &token);
+      break;
+    }
+
     ++loop_count;
     assert(loop_count < 1000000000);
 
   } while ((token.type != GUMBO_TOKEN_EOF || state->_reprocess_current_token) &&
            !(parser._options->stop_on_first_error && has_error));
 
+  if (pipeline) {
+    pipeline->stop(pipeline->userdata);
+  }
   finish_parsing(&parser);
+  evict_closed_elements(&parser);
   // For API uniformity reasons, if the doctype still has nulls, convert them to
   // empty strings.
   GumboDocument* doc_type = &parser._output->document->v.document;
@@ -4210,11 +4727,64 @@ GumboOutput* gumbo_parse_fragment(
     doc_type->system_identifier = gumbo_strdup("");
   }
 
-  parser_state_destroy(&parser);
-  gumbo_tokenizer_state_destroy(&parser);
+  if (handle) {
+    handle->_parser_state = parser_state_detach(&parser);
+    handle->_tokenizer_state = gumbo_tokenizer_state_detach(&parser);
+  } else {
+    parser_state_destroy(&parser);
+    gumbo_tokenizer_state_destroy(&parser);
+  }
   return parser._output;
 }
 
+GumboOutput* gumbo_parse_fragment(
+    const GumboOptions* options, const char* buffer, size_t length,
+    const GumboTag fragment_ctx, const GumboNamespaceEnum fragment_namespace) {
+  return parse_fragment(
+      NULL, options, buffer, length, fragment_ctx, fragment_namespace, NULL);
+}
+
+GumboOutput* gumbo_parse_pipelined(
+    const GumboOptions* options, const char* buffer, size_t length,
+    const GumboTokenPipeline* pipeline) {
+  return parse_fragment(NULL, options, buffer, length, GUMBO_TAG_LAST,
+                        GUMBO_NAMESPACE_HTML, pipeline);
+}
+
+GumboParserHandle* gumbo_create_parser(void) {
+  GumboParserHandle* handle = gumbo_malloc(sizeof(GumboParserHandle));
+  handle->_parser_state = NULL;
+  handle->_tokenizer_state = NULL;
+  return handle;
+}
+
+GumboOutput* gumbo_parser_parse_fragment(
+    GumboParserHandle* handle, const GumboOptions* options,
+    const char* buffer, size_t length, const GumboTag fragment_ctx,
+    const GumboNamespaceEnum fragment_namespace) {
+  return parse_fragment(handle, options, buffer, length, fragment_ctx,
+                        fragment_namespace, NULL);
+}
+
+void gumbo_parser_reset(GumboParserHandle* handle) {
+  GumboParser parser;
+  if (handle->_parser_state) {
+    parser._parser_state = handle->_parser_state;
+    parser_state_destroy(&parser);
+    handle->_parser_state = NULL;
+  }
+  if (handle->_tokenizer_state) {
+    parser._tokenizer_state = handle->_tokenizer_state;
+    gumbo_tokenizer_state_destroy(&parser);
+    handle->_tokenizer_state = NULL;
+  }
+}
+
+void gumbo_destroy_parser(GumboParserHandle* handle) {
+  gumbo_parser_reset(handle);
+  gumbo_free(handle);
+}
+
 void gumbo_destroy_output(GumboOutput* output) {
   free_node(output->document);
   for (unsigned int i = 0; i < output->errors.length; ++i) {
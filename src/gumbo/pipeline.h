@@ -0,0 +1,68 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This contains a parse entry point that takes its tokens from a GumboLexer
+// running ahead of the tree builder, e.g. on another thread, instead of
+// calling gumbo_lex itself.
+//
+// The lexer predicts the tokenizer state switches and foreign content of the
+// tree builder (see lexer.h).  The tree builder checks every token against
+// what it would have done itself, and where the lexer guessed wrong it
+// restarts the lexer from the checkpoint of that token and drops the tokens
+// lexed after it.  The output is the same as that of gumbo_parse_with_options.
+
+#ifndef GUMBO_PIPELINE_H_
+#define GUMBO_PIPELINE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gumbo.h"
+#include "lexer.h"
+#include "tokenizer_states.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The source of lookahead tokens.  All functions are called from the thread
+// that parses.
+typedef struct GumboInternalTokenPipeline {
+  // Starts a GumboLexer over the text being parsed, with the same options, in
+  // the specified tokenizer state.  Called once, before anything else.
+  void (*start)(void* userdata, GumboTokenizerEnum state);
+
+  // Moves the next token into output, waiting for it if necessary.  The
+  // ownership of the token and the errors passes to the caller.
+  void (*next)(void* userdata, GumboLookaheadToken* output);
+
+  // Drops the tokens lexed so far and restarts the lexer with
+  // gumbo_lexer_restart.  The checkpoint is only valid during the call.
+  void (*restart)(void* userdata, const GumboLexerCheckpoint* checkpoint,
+                  GumboTokenizerEnum state, bool is_current_node_foreign);
+
+  // Stops the lexer and frees the tokens that have not been taken.
+  void (*stop)(void* userdata);
+
+  void* userdata;
+} GumboTokenPipeline;
+
+// Same as gumbo_parse_with_options, with the tokens taken from pipeline.
+GumboOutput* gumbo_parse_pipelined(
+    const GumboOptions* options, const char* buffer, size_t length,
+    const GumboTokenPipeline* pipeline);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUMBO_PIPELINE_H_
@@ -71,74 +71,33 @@ void gumbo_tag_from_original_text(GumboStringPiece* text) {
 }
 
 /*
- * Override the `tolower` implementation in the perfect hash
- * to use ours. We need a custom `tolower` that only does ASCII
- * characters and is locale-independent to remain truthy to the
- * standard
+ * The perfect hash only ever sees lowercase names: the tokenizer
+ * lowercases tag names as it scans them, and gumbo_tagn_enum lowercases
+ * its argument with our ASCII-only, locale-independent `tolower` first.
  */
-#define perfhash_tolower(c) gumbo_tolower(c)
+#define perfhash_tolower(c) (c)
 #include "tag_perf.h"
 
-static int
-case_memcmp(const char *s1, const char *s2, int n)
-{
-	while (n--) {
-		unsigned char c1 = gumbo_tolower(*s1++);
-		unsigned char c2 = gumbo_tolower(*s2++);
-		if (c1 != c2)
-			return (int)c1 - (int)c2;
-	}
-	return 0;
-}
-
+// Longest key accepted by perfhash.
+#define kMaxTagNameLength 22
 
-GumboTag gumbo_tagn_enum(const char* tagname, int length) {
+GumboTag gumbo_tagn_enum_lowercase(const char* tagname, int length) {
   int position = perfhash((const unsigned char *)tagname, length);
   if (position >= 0 &&
       length == kGumboTagSizes[position] &&
-      !case_memcmp(tagname, kGumboTagNames[position], length))
+      !memcmp(tagname, kGumboTagNames[position], length))
     return (GumboTag)position;
   return GUMBO_TAG_UNKNOWN;
 }
 
-
-#if 0
-/**
- * This version removes unrecognized svg and mathml prefixes from
- * tags to force the gumbo parser to actually recognize that svg:svg is 
- * actually an svg tag and similarly for m:math and mml:math and even math:math.
- * Without it gumbo treats these as unknown tags in the html namespace 
- * and not to the correct svg or mathml namespaces 
- **/
 GumboTag gumbo_tagn_enum(const char* tagname, int length) {
-  /* handle replacement of standard prefixes */
-  const char * tagnameptr;
-  int tagnamelength;
-  int position = -1;
-  if (!case_memcmp(tagname, "svg:", 4)) {
-    tagnameptr = tagname + 4;
-    tagnamelength = length - 4;
-  } else if (!case_memcmp(tagname, "m:", 2)) {
-    tagnameptr = tagname + 2;
-    tagnamelength = length - 2;
-  } else if (!case_memcmp(tagname, "mml:", 4)) {
-    tagnameptr = tagname + 4;
-    tagnamelength = length - 4;
-  } else if (!case_memcmp(tagname, "math:", 5)) {
-    tagnameptr = tagname + 5;
-    tagnamelength = length - 5;
-  } else {
-    tagnameptr = tagname;
-    tagnamelength = length;
-  }
-  position = perfhash((const unsigned char *)tagnameptr, tagnamelength);
-  if (position >= 0 &&
-      tagnamelength == kGumboTagSizes[position] &&
-      !case_memcmp(tagnameptr, kGumboTagNames[position], tagnamelength))
-    return (GumboTag)position;
-  return GUMBO_TAG_UNKNOWN;
+  char lowercase[kMaxTagNameLength];
+  if (length < 1 || length > kMaxTagNameLength)
+    return GUMBO_TAG_UNKNOWN;
+  for (int i = 0; i < length; ++i)
+    lowercase[i] = gumbo_tolower(tagname[i]);
+  return gumbo_tagn_enum_lowercase(lowercase, length);
 }
-#endif
 
 
 GumboTag gumbo_tag_enum(const char* tagname) {
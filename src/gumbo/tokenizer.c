@@ -136,6 +136,10 @@ typedef struct GumboInternalTokenizerState {
   // markup declaration state.
   bool _is_current_node_foreign;
 
+  // Set when the markup declaration state reads _is_current_node_foreign, and
+  // cleared whenever it is set.
+  bool _checked_current_node_foreign;
+
   // A flag indicating whether the tokenizer is in a CDATA section.  If so, then
   // text tokens emitted will be GUMBO_TOKEN_CDATA.
   bool _is_in_cdata;
@@ -645,6 +649,12 @@ static bool emit_temporary_buffer(
   return maybe_emit_from_temporary_buffer(parser, output);
 }
 
+static void mark_truncated(GumboParser* parser) {
+  if (parser->_output->status == GUMBO_STATUS_OK) {
+    parser->_output->status = GUMBO_STATUS_TRUNCATED;
+  }
+}
+
 // Appends a codepoint to the current tag buffer.  If
 // reinitilize_position_on_first is set, this also initializes the tag buffer
 // start point; the only time you would *not* want to pass true for this
@@ -659,6 +669,41 @@ static void append_char_to_tag_buffer(GumboParser* parser, int codepoint,
   gumbo_string_buffer_append_codepoint(codepoint, buffer);
 }
 
+// Appends the current character of a tag or attribute name to the tag buffer,
+// together with the run of plain name characters (GUMBO_CHAR_TAG_NAME or
+// GUMBO_CHAR_ATTR_NAME) that follows it, lowercasing them all.  The input is
+// left on the last character of the run, so the caller returns NEXT_CHAR as
+// if it had appended a single character.
+static void append_name_span_to_tag_buffer(GumboParser* parser, int c,
+                                           bool is_attr_name) {
+  append_char_to_tag_buffer(parser, gumbo_tolower(c), true);
+  if (c >= 0x80) {
+    // Only an ASCII current character is known to be one byte wide.
+    return;
+  }
+  Utf8Iterator* input = &parser->_tokenizer_state->_input;
+  const char* start = utf8iterator_get_char_pointer(input) + 1;
+  const char* end = utf8iterator_get_end_pointer(input);
+  unsigned char name_class =
+      is_attr_name ? GUMBO_CHAR_ATTR_NAME : GUMBO_CHAR_TAG_NAME;
+  const char* pos = start;
+  while (pos < end && (kGumboCharClass[(unsigned char) *pos] & name_class)) {
+    ++pos;
+  }
+  size_t length = pos - start;
+  if (length == 0) {
+    return;
+  }
+
+  GumboStringBuffer* buffer = &parser->_tokenizer_state->_tag_state._buffer;
+  gumbo_string_buffer_reserve(buffer->length + length, buffer);
+  for (size_t i = 0; i < length; ++i) {
+    buffer->data[buffer->length + i] = gumbo_tolower(start[i]);
+  }
+  buffer->length += length;
+  utf8iterator_skip_ascii(input, length);
+}
+
 // (Re-)initialize the tag buffer.  This also resets the original_text pointer
 // and _start_pos field to point to the current position.
 static void initialize_tag_buffer(GumboParser* parser) {
@@ -741,7 +786,7 @@ static void finish_tag_name(GumboParser* parser) {
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   GumboTagState* tag_state = &tokenizer->_tag_state;
 
-  tag_state->_tag = gumbo_tagn_enum(
+  tag_state->_tag = gumbo_tagn_enum_lowercase(
 		tag_state->_buffer.data, tag_state->_buffer.length);
   reinitialize_tag_buffer(parser);
 }
@@ -760,7 +805,6 @@ static void add_duplicate_attr_error(GumboParser* parser, const char* attr_name,
   error->v.duplicate_attr.original_index = original_index;
   error->v.duplicate_attr.new_index = new_index;
   copy_over_tag_buffer(parser, &error->v.duplicate_attr.name);
-  reinitialize_tag_buffer(parser);
 }
 
 // Creates a new attribute in the current tag, copying the current tag buffer to
@@ -778,6 +822,14 @@ static bool finish_attribute_name(GumboParser* parser) {
   assert(tag_state->_attributes.capacity);
 
   GumboVector* /* GumboAttribute* */ attributes = &tag_state->_attributes;
+  int max_attributes = parser->_options->max_attributes;
+  if (max_attributes >= 0 && attributes->length >= (unsigned int) max_attributes) {
+    // Drop the attribute like a duplicate one, but without a parse error.
+    mark_truncated(parser);
+    tag_state->_drop_next_attr_value = true;
+    reinitialize_tag_buffer(parser);
+    return false;
+  }
   for (unsigned int i = 0; i < attributes->length; ++i) {
     GumboAttribute* attr = attributes->data[i];
     if (strlen(attr->name) == tag_state->_buffer.length &&
@@ -787,6 +839,10 @@ static bool finish_attribute_name(GumboParser* parser) {
       add_duplicate_attr_error(
           parser, attr->name, i, attributes->length);
       tag_state->_drop_next_attr_value = true;
+      // Reset here rather than in add_duplicate_attr_error, which returns
+      // early once max_errors is reached, or the name would run into the next
+      // one.
+      reinitialize_tag_buffer(parser);
       return false;
     }
   }
@@ -797,8 +853,10 @@ static bool finish_attribute_name(GumboParser* parser) {
   copy_over_original_tag_text(parser, &attr->original_name,
                               &attr->name_start, &attr->name_end);
   attr->value = gumbo_strdup("");
+  // Until finish_attribute_value sees a value, the value is the name span, so
+  // attributes without one, like <a href>, still get defined positions.
   copy_over_original_tag_text(parser, &attr->original_value,
-                              &attr->name_start, &attr->name_end);
+                              &attr->value_start, &attr->value_end);
   gumbo_vector_add(attr, attributes);
   reinitialize_tag_buffer(parser);
   return true;
@@ -816,6 +874,18 @@ static void finish_attribute_value(GumboParser* parser) {
     return;
   }
 
+  GumboStringBuffer* buffer = &tag_state->_buffer;
+  ptrdiff_t max_length = parser->_options->max_attribute_length;
+  if (max_length >= 0 && buffer->length > (size_t) max_length) {
+    // Cut at a character boundary so the value stays valid UTF-8.
+    buffer->length = max_length;
+    while (buffer->length > 0 &&
+           (buffer->data[buffer->length] & 0xC0) == 0x80) {
+      --buffer->length;
+    }
+    mark_truncated(parser);
+  }
+
   GumboAttribute* attr =
       tag_state->_attributes.data[tag_state->_attributes.length - 1];
   gumbo_free((void*) attr->value);
@@ -831,32 +901,60 @@ static bool is_appropriate_end_tag(GumboParser* parser) {
   assert(!tag_state->_is_start_tag);
   return tag_state->_last_start_tag != GUMBO_TAG_LAST &&
       tag_state->_last_start_tag ==
-	  gumbo_tagn_enum(tag_state->_buffer.data, tag_state->_buffer.length);
+	  gumbo_tagn_enum_lowercase(
+	      tag_state->_buffer.data, tag_state->_buffer.length);
 }
 
-void gumbo_tokenizer_state_init(
+// Sets up a parse of the specified text with the buffers of the tokenizer
+// already allocated.
+static void tokenizer_state_start(
     GumboParser* parser, const char* text, size_t text_length) {
-  GumboTokenizerState* tokenizer = gumbo_malloc(sizeof(GumboTokenizerState));
-  parser->_tokenizer_state = tokenizer;
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
   tokenizer->_reconsume_current_input = false;
   tokenizer->_is_current_node_foreign = false;
+  tokenizer->_checked_current_node_foreign = false;
   tokenizer->_is_in_cdata = false;
   tokenizer->_tag_state._last_start_tag = GUMBO_TAG_LAST;
 
   tokenizer->_buffered_emit_char = kGumboNoChar;
-  gumbo_string_buffer_init(&tokenizer->_temporary_buffer);
   tokenizer->_temporary_buffer_emit = NULL;
 
   mark_tag_state_as_empty(&tokenizer->_tag_state);
 
-  gumbo_string_buffer_init(&tokenizer->_script_data_buffer);
   tokenizer->_token_start = text;
   utf8iterator_init(parser, text, text_length, &tokenizer->_input);
   utf8iterator_get_position(&tokenizer->_input, &tokenizer->_token_start_pos);
   doc_type_state_init(parser);
 }
 
+void gumbo_tokenizer_state_init(
+    GumboParser* parser, const char* text, size_t text_length) {
+  GumboTokenizerState* tokenizer = gumbo_malloc(sizeof(GumboTokenizerState));
+  parser->_tokenizer_state = tokenizer;
+  gumbo_string_buffer_init(&tokenizer->_temporary_buffer);
+  gumbo_string_buffer_init(&tokenizer->_script_data_buffer);
+  tokenizer_state_start(parser, text, text_length);
+}
+
+void gumbo_tokenizer_state_reuse(
+    GumboParser* parser, GumboTokenizerState* tokenizer, const char* text,
+    size_t text_length) {
+  parser->_tokenizer_state = tokenizer;
+  gumbo_string_buffer_clear(&tokenizer->_temporary_buffer);
+  gumbo_string_buffer_clear(&tokenizer->_script_data_buffer);
+  tokenizer_state_start(parser, text, text_length);
+}
+
+GumboTokenizerState* gumbo_tokenizer_state_detach(GumboParser* parser) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  assert(tokenizer->_doc_type_state.name == NULL);
+  assert(tokenizer->_doc_type_state.public_identifier == NULL);
+  assert(tokenizer->_doc_type_state.system_identifier == NULL);
+  parser->_tokenizer_state = NULL;
+  return tokenizer;
+}
+
 void gumbo_tokenizer_state_destroy(GumboParser* parser) {
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   assert(tokenizer->_doc_type_state.name == NULL);
@@ -871,6 +969,19 @@ void gumbo_tokenizer_set_state(GumboParser* parser, GumboTokenizerEnum state) {
   parser->_tokenizer_state->_state = state;
 }
 
+GumboTokenizerEnum gumbo_tokenizer_get_state(const GumboParser* parser) {
+  return parser->_tokenizer_state->_state;
+}
+
+void gumbo_tokenizer_make_eof_token(GumboParser* parser, GumboToken* output) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  output->type = GUMBO_TOKEN_EOF;
+  output->v.character = -1;
+  output->position = tokenizer->_token_start_pos;
+  output->original_text.data = tokenizer->_token_start;
+  output->original_text.length = 0;
+}
+
 void gumbo_tokenizer_set_is_current_node_foreign(
     GumboParser* parser, bool is_foreign) {
   if (is_foreign != parser->_tokenizer_state->_is_current_node_foreign) {
@@ -878,6 +989,62 @@ void gumbo_tokenizer_set_is_current_node_foreign(
                 is_foreign ? "true" : "false");
   }
   parser->_tokenizer_state->_is_current_node_foreign = is_foreign;
+  parser->_tokenizer_state->_checked_current_node_foreign = false;
+}
+
+bool gumbo_tokenizer_checked_current_node_foreign(const GumboParser* parser) {
+  return parser->_tokenizer_state->_checked_current_node_foreign;
+}
+
+void gumbo_tokenizer_save(
+    const GumboParser* parser, GumboTokenizerCheckpoint* checkpoint) {
+  const GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  const GumboStringBuffer* buffer = &tokenizer->_temporary_buffer;
+  checkpoint->_input = tokenizer->_input;
+  checkpoint->_token_start = tokenizer->_token_start;
+  checkpoint->_token_start_pos = tokenizer->_token_start_pos;
+  checkpoint->_last_start_tag = tokenizer->_tag_state._last_start_tag;
+  checkpoint->_reconsume_current_input = tokenizer->_reconsume_current_input;
+  checkpoint->_is_in_cdata = tokenizer->_is_in_cdata;
+  // A temporary buffer that has been emitted to the end is dropped by the next
+  // gumbo_lex anyway.
+  checkpoint->_is_restorable =
+      tokenizer->_buffered_emit_char == kGumboNoChar &&
+      (!tokenizer->_temporary_buffer_emit ||
+       tokenizer->_temporary_buffer_emit >= buffer->data + buffer->length);
+}
+
+void gumbo_tokenizer_restore(GumboParser* parser,
+    const GumboTokenizerCheckpoint* checkpoint, GumboTokenizerEnum state) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  assert(checkpoint->_is_restorable);
+  // Tags and doctypes are always finished by the gumbo_lex call that starts
+  // them, so there is nothing in progress to drop.
+  assert(tokenizer->_doc_type_state.name == NULL);
+  tokenizer->_input = checkpoint->_input;
+  // The checkpoint may come from the tokenizer of another lexer over the same
+  // text.
+  tokenizer->_input._parser = parser;
+  tokenizer->_token_start = checkpoint->_token_start;
+  tokenizer->_token_start_pos = checkpoint->_token_start_pos;
+  tokenizer->_tag_state._last_start_tag = checkpoint->_last_start_tag;
+  tokenizer->_reconsume_current_input = checkpoint->_reconsume_current_input;
+  tokenizer->_is_in_cdata = checkpoint->_is_in_cdata;
+  tokenizer->_buffered_emit_char = kGumboNoChar;
+  tokenizer->_temporary_buffer_emit = NULL;
+  tokenizer->_state = state;
+}
+
+void gumbo_tokenizer_get_token_start(const GumboParser* parser,
+    const char** start, GumboSourcePosition* position) {
+  *start = parser->_tokenizer_state->_token_start;
+  *position = parser->_tokenizer_state->_token_start_pos;
+}
+
+void gumbo_tokenizer_set_token_start(GumboParser* parser, const char* start,
+    const GumboSourcePosition* position) {
+  parser->_tokenizer_state->_token_start = start;
+  parser->_tokenizer_state->_token_start_pos = *position;
 }
 
 // http://www.whatwg.org/specs/web-apps/current-work/complete5/tokenization.html#data-state
@@ -1089,7 +1256,7 @@ static StateResult handle_tag_name_state(
       gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
       return NEXT_CHAR;
     default:
-      append_char_to_tag_buffer(parser, gumbo_tolower(c), true);
+      append_name_span_to_tag_buffer(parser, c, false);
       return NEXT_CHAR;
   }
 }
@@ -1697,7 +1864,7 @@ static StateResult handle_attr_name_state(
       tokenizer_add_parse_error(parser, GUMBO_ERR_ATTR_NAME_INVALID);
       // Fall through.
     default:
-      append_char_to_tag_buffer(parser, gumbo_tolower(c), true);
+      append_name_span_to_tag_buffer(parser, c, true);
       return NEXT_CHAR;
   }
 }
@@ -2008,6 +2175,12 @@ static StateResult handle_bogus_comment_state(
   return emit_comment(parser, output);
 }
 
+// Reads _is_current_node_foreign, recording that the token depends on it.
+static bool is_current_node_foreign(GumboTokenizerState* tokenizer) {
+  tokenizer->_checked_current_node_foreign = true;
+  return tokenizer->_is_current_node_foreign;
+}
+
 // http://www.whatwg.org/specs/web-apps/current-work/complete.html#markup-declaration-open-state
 static StateResult handle_markup_declaration_state(
     GumboParser* parser, GumboTokenizerState* tokenizer,
@@ -2029,7 +2202,7 @@ static StateResult handle_markup_declaration_state(
         gumbo_strdup("");
     tokenizer->_doc_type_state.system_identifier =
         gumbo_strdup("");
-  } else if (tokenizer->_is_current_node_foreign &&
+  } else if (is_current_node_foreign(tokenizer) &&
              utf8iterator_maybe_consume_match(
                 &tokenizer->_input, "[CDATA[", sizeof("[CDATA[") - 1, true)) {
     gumbo_tokenizer_set_state(parser, GUMBO_LEX_CDATA);
@@ -2814,79 +2987,99 @@ static StateResult handle_cdata_state(
   }
 }
 
+// Build with -DGUMBO_THREADED_DISPATCH=1 to dispatch the states of gumbo_lex
+// with computed gotos instead of the function table.  It needs the "labels
+// as values" extension of GCC and Clang.  It is off by default because
+// gumbo_lex returns after almost every character token, so there is little
+// dispatch overhead left to remove, and it measures the same as the table.
+#ifndef GUMBO_THREADED_DISPATCH
+#define GUMBO_THREADED_DISPATCH 0
+#endif
+#if GUMBO_THREADED_DISPATCH && !defined(__GNUC__)
+#error "GUMBO_THREADED_DISPATCH needs GCC or Clang"
+#endif
+
+// The state handlers, in the order of GumboTokenizerEnum.
+#define GUMBO_LEXER_STATES(X) \
+  X(handle_data_state) \
+  X(handle_char_ref_in_data_state) \
+  X(handle_rcdata_state) \
+  X(handle_char_ref_in_rcdata_state) \
+  X(handle_rawtext_state) \
+  X(handle_script_state) \
+  X(handle_plaintext_state) \
+  X(handle_tag_open_state) \
+  X(handle_end_tag_open_state) \
+  X(handle_tag_name_state) \
+  X(handle_rcdata_lt_state) \
+  X(handle_rcdata_end_tag_open_state) \
+  X(handle_rcdata_end_tag_name_state) \
+  X(handle_rawtext_lt_state) \
+  X(handle_rawtext_end_tag_open_state) \
+  X(handle_rawtext_end_tag_name_state) \
+  X(handle_script_lt_state) \
+  X(handle_script_end_tag_open_state) \
+  X(handle_script_end_tag_name_state) \
+  X(handle_script_escaped_start_state) \
+  X(handle_script_escaped_start_dash_state) \
+  X(handle_script_escaped_state) \
+  X(handle_script_escaped_dash_state) \
+  X(handle_script_escaped_dash_dash_state) \
+  X(handle_script_escaped_lt_state) \
+  X(handle_script_escaped_end_tag_open_state) \
+  X(handle_script_escaped_end_tag_name_state) \
+  X(handle_script_double_escaped_start_state) \
+  X(handle_script_double_escaped_state) \
+  X(handle_script_double_escaped_dash_state) \
+  X(handle_script_double_escaped_dash_dash_state) \
+  X(handle_script_double_escaped_lt_state) \
+  X(handle_script_double_escaped_end_state) \
+  X(handle_before_attr_name_state) \
+  X(handle_attr_name_state) \
+  X(handle_after_attr_name_state) \
+  X(handle_before_attr_value_state) \
+  X(handle_attr_value_double_quoted_state) \
+  X(handle_attr_value_single_quoted_state) \
+  X(handle_attr_value_unquoted_state) \
+  X(handle_char_ref_in_attr_value_state) \
+  X(handle_after_attr_value_quoted_state) \
+  X(handle_self_closing_start_tag_state) \
+  X(handle_bogus_comment_state) \
+  X(handle_markup_declaration_state) \
+  X(handle_comment_start_state) \
+  X(handle_comment_start_dash_state) \
+  X(handle_comment_state) \
+  X(handle_comment_end_dash_state) \
+  X(handle_comment_end_state) \
+  X(handle_comment_end_bang_state) \
+  X(handle_doctype_state) \
+  X(handle_before_doctype_name_state) \
+  X(handle_doctype_name_state) \
+  X(handle_after_doctype_name_state) \
+  X(handle_after_doctype_public_keyword_state) \
+  X(handle_before_doctype_public_id_state) \
+  X(handle_doctype_public_id_double_quoted_state) \
+  X(handle_doctype_public_id_single_quoted_state) \
+  X(handle_after_doctype_public_id_state) \
+  X(handle_between_doctype_public_system_id_state) \
+  X(handle_after_doctype_system_keyword_state) \
+  X(handle_before_doctype_system_id_state) \
+  X(handle_doctype_system_id_double_quoted_state) \
+  X(handle_doctype_system_id_single_quoted_state) \
+  X(handle_after_doctype_system_id_state) \
+  X(handle_bogus_doctype_state) \
+  X(handle_cdata_state)
+
+#if !GUMBO_THREADED_DISPATCH
 typedef StateResult (*GumboLexerStateFunction)(
     GumboParser*, GumboTokenizerState*, int, GumboToken*);
 
+#define DISPATCH_TABLE_ENTRY(handler) handler,
 static GumboLexerStateFunction dispatch_table[] = {
-  handle_data_state,
-  handle_char_ref_in_data_state,
-  handle_rcdata_state,
-  handle_char_ref_in_rcdata_state,
-  handle_rawtext_state,
-  handle_script_state,
-  handle_plaintext_state,
-  handle_tag_open_state,
-  handle_end_tag_open_state,
-  handle_tag_name_state,
-  handle_rcdata_lt_state,
-  handle_rcdata_end_tag_open_state,
-  handle_rcdata_end_tag_name_state,
-  handle_rawtext_lt_state,
-  handle_rawtext_end_tag_open_state,
-  handle_rawtext_end_tag_name_state,
-  handle_script_lt_state,
-  handle_script_end_tag_open_state,
-  handle_script_end_tag_name_state,
-  handle_script_escaped_start_state,
-  handle_script_escaped_start_dash_state,
-  handle_script_escaped_state,
-  handle_script_escaped_dash_state,
-  handle_script_escaped_dash_dash_state,
-  handle_script_escaped_lt_state,
-  handle_script_escaped_end_tag_open_state,
-  handle_script_escaped_end_tag_name_state,
-  handle_script_double_escaped_start_state,
-  handle_script_double_escaped_state,
-  handle_script_double_escaped_dash_state,
-  handle_script_double_escaped_dash_dash_state,
-  handle_script_double_escaped_lt_state,
-  handle_script_double_escaped_end_state,
-  handle_before_attr_name_state,
-  handle_attr_name_state,
-  handle_after_attr_name_state,
-  handle_before_attr_value_state,
-  handle_attr_value_double_quoted_state,
-  handle_attr_value_single_quoted_state,
-  handle_attr_value_unquoted_state,
-  handle_char_ref_in_attr_value_state,
-  handle_after_attr_value_quoted_state,
-  handle_self_closing_start_tag_state,
-  handle_bogus_comment_state,
-  handle_markup_declaration_state,
-  handle_comment_start_state,
-  handle_comment_start_dash_state,
-  handle_comment_state,
-  handle_comment_end_dash_state,
-  handle_comment_end_state,
-  handle_comment_end_bang_state,
-  handle_doctype_state,
-  handle_before_doctype_name_state,
-  handle_doctype_name_state,
-  handle_after_doctype_name_state,
-  handle_after_doctype_public_keyword_state,
-  handle_before_doctype_public_id_state,
-  handle_doctype_public_id_double_quoted_state,
-  handle_doctype_public_id_single_quoted_state,
-  handle_after_doctype_public_id_state,
-  handle_between_doctype_public_system_id_state,
-  handle_after_doctype_system_keyword_state,
-  handle_before_doctype_system_id_state,
-  handle_doctype_system_id_double_quoted_state,
-  handle_doctype_system_id_single_quoted_state,
-  handle_after_doctype_system_id_state,
-  handle_bogus_doctype_state,
-  handle_cdata_state
+  GUMBO_LEXER_STATES(DISPATCH_TABLE_ENTRY)
 };
+#undef DISPATCH_TABLE_ENTRY
+#endif
 
 bool gumbo_lex(GumboParser* parser, GumboToken* output) {
   // Because of the spec requirements that...
@@ -2920,6 +3113,48 @@ bool gumbo_lex(GumboParser* parser, GumboToken* output) {
     return true;
   }
 
+#if GUMBO_THREADED_DISPATCH
+  // Every state ends with its own indirect jump to the handler of the next
+  // state, so the jumps are predicted per state, and the handlers, which
+  // have no other callers, are inlined here.
+#define STATE_LABEL(handler) &&handler##_label,
+  static const void* const state_labels[] = {
+    GUMBO_LEXER_STATES(STATE_LABEL)
+  };
+#undef STATE_LABEL
+  int c;
+  StateResult result;
+  bool should_advance;
+
+#define DISPATCH() \
+  do { \
+    assert(!tokenizer->_temporary_buffer_emit); \
+    assert(tokenizer->_buffered_emit_char == kGumboNoChar); \
+    c = utf8iterator_current(&tokenizer->_input); \
+    gumbo_debug("Lexing character '%c' (%d) in state %d.\n", \
+        c, c, tokenizer->_state); \
+    goto *state_labels[tokenizer->_state]; \
+  } while (0)
+
+  // Same as the body of the loop below.
+#define STATE_CASE(handler) \
+  handler##_label: \
+    result = handler(parser, tokenizer, c, output); \
+    should_advance = !tokenizer->_reconsume_current_input; \
+    tokenizer->_reconsume_current_input = false; \
+    if (result != NEXT_CHAR) { \
+      return result == RETURN_SUCCESS; \
+    } \
+    if (should_advance) { \
+      utf8iterator_next(&tokenizer->_input); \
+    } \
+    DISPATCH();
+
+  DISPATCH();
+  GUMBO_LEXER_STATES(STATE_CASE)
+#undef STATE_CASE
+#undef DISPATCH
+#else
   while (1) {
     assert(!tokenizer->_temporary_buffer_emit);
     assert(tokenizer->_buffered_emit_char == kGumboNoChar);
@@ -2943,6 +3178,7 @@ bool gumbo_lex(GumboParser* parser, GumboToken* output) {
       utf8iterator_next(&tokenizer->_input);
     }
   }
+#endif
 }
 
 void gumbo_token_destroy(GumboToken* token) {
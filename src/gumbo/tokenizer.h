@@ -26,12 +26,14 @@
 #include "gumbo.h"
 #include "token_type.h"
 #include "tokenizer_states.h"
+#include "utf8.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct GumboInternalParser;
+struct GumboInternalTokenizerState;
 
 // Struct containing all information pertaining to doctype tokens.
 typedef struct GumboInternalTokenDocType {
@@ -69,21 +71,54 @@ typedef struct GumboInternalToken {
   } v;
 } GumboToken;
 
+// The position of the tokenizer between two tokens, saved with
+// gumbo_tokenizer_save so that lexing can be restarted there with
+// gumbo_tokenizer_restore.  This lets a lexer run ahead of the tree builder
+// and back off where the tree builder switched the tokenizer state.
+typedef struct GumboInternalTokenizerCheckpoint {
+  Utf8Iterator _input;
+  const char* _token_start;
+  GumboSourcePosition _token_start_pos;
+  GumboTag _last_start_tag;
+  bool _reconsume_current_input;
+  bool _is_in_cdata;
+  // False if the tokenizer was still emitting buffered characters, which the
+  // checkpoint does not keep.  This is never the case after a start tag, or
+  // before a token that depends on is_current_node_foreign.
+  bool _is_restorable;
+} GumboTokenizerCheckpoint;
+
 // Initializes the tokenizer state within the GumboParser object, setting up a
 // parse of the specified text.
 void gumbo_tokenizer_state_init(
     struct GumboInternalParser* parser, const char* text, size_t text_length);
 
+// Same as gumbo_tokenizer_state_init, but reuses a tokenizer state detached
+// from an earlier parse with gumbo_tokenizer_state_detach.
+void gumbo_tokenizer_state_reuse(
+    struct GumboInternalParser* parser,
+    struct GumboInternalTokenizerState* tokenizer, const char* text,
+    size_t text_length);
+
 // Destroys the tokenizer state within the GumboParser object, freeing any
 // dynamically-allocated structures within it.
 void gumbo_tokenizer_state_destroy(struct GumboInternalParser* parser);
 
+// Detaches the tokenizer state from the GumboParser object at the end of a
+// parse and returns it, keeping its buffers for gumbo_tokenizer_state_reuse.
+struct GumboInternalTokenizerState* gumbo_tokenizer_state_detach(
+    struct GumboInternalParser* parser);
+
 // Sets the tokenizer state to the specified value.  This is needed by some
 // parser states, which alter the state of the tokenizer in response to tags
 // seen.
 void gumbo_tokenizer_set_state(
     struct GumboInternalParser* parser, GumboTokenizerEnum state);
 
+// Returns the current tokenizer state.
+GumboTokenizerEnum gumbo_tokenizer_get_state(
+    const struct GumboInternalParser* parser);
+
 // Flags whether the current node is a foreign content element.  This is
 // necessary for the markup declaration open state, where the tokenizer must be
 // aware of the state of the parser to properly tokenize bad comment tags.
@@ -91,6 +126,40 @@ void gumbo_tokenizer_set_state(
 void gumbo_tokenizer_set_is_current_node_foreign(
     struct GumboInternalParser* parser, bool is_foreign);
 
+// Returns true if the flag set by gumbo_tokenizer_set_is_current_node_foreign
+// has been read since it was last set, i.e. if the tokens lexed since then
+// could have come out differently with the other value.
+bool gumbo_tokenizer_checked_current_node_foreign(
+    const struct GumboInternalParser* parser);
+
+// Saves the position of the tokenizer, which must be between two tokens.
+void gumbo_tokenizer_save(
+    const struct GumboInternalParser* parser,
+    GumboTokenizerCheckpoint* checkpoint);
+
+// Restores a position saved with gumbo_tokenizer_save in the specified
+// tokenizer state.  The checkpoint must be restorable.
+void gumbo_tokenizer_restore(
+    struct GumboInternalParser* parser,
+    const GumboTokenizerCheckpoint* checkpoint, GumboTokenizerEnum state);
+
+// Gets the start of the next token, where gumbo_tokenizer_make_eof_token puts
+// the EOF token.
+void gumbo_tokenizer_get_token_start(
+    const struct GumboInternalParser* parser, const char** start,
+    GumboSourcePosition* position);
+
+// Sets the start of the next token, for a tokenizer that is only used to track
+// the state while the tokens come from elsewhere.
+void gumbo_tokenizer_set_token_start(
+    struct GumboInternalParser* parser, const char* start,
+    const GumboSourcePosition* position);
+
+// Fills in an EOF token at the position where the next token would start, as
+// if the input ended there.  This is used to stop parsing early.
+void gumbo_tokenizer_make_eof_token(
+    struct GumboInternalParser* parser, GumboToken* output);
+
 // Lexes a single token from the specified buffer, filling the output with the
 // parsed GumboToken data structure.  Returns true for a successful
 // tokenization, false if a parse error occurs.
@@ -177,6 +177,9 @@ static void read_char(Utf8Iterator* iter) {
 
 static void update_position(Utf8Iterator* iter) {
   iter->_pos.offset += iter->_width;
+  if (!iter->_track_line_column) {
+    return;
+  }
   if (iter->_current == '\n') {
     ++iter->_pos.line;
     iter->_pos.column = 1;
@@ -201,10 +204,19 @@ void utf8iterator_init(
     Utf8Iterator* iter) {
   iter->_start = source;
   iter->_end = source + source_length;
-  iter->_pos.line = 1;
-  iter->_pos.column = 1;
-  iter->_pos.offset = 0;
   iter->_parser = parser;
+  iter->_track_line_column = parser->_options->track_line_column;
+  iter->_pos.line = iter->_track_line_column ? 1 : 0;
+  iter->_pos.column = iter->_track_line_column ? 1 : 0;
+  iter->_pos.offset = 0;
+  read_char(iter);
+}
+
+void utf8iterator_seek(
+    Utf8Iterator* iter, const char* position, const GumboSourcePosition* pos) {
+  assert(position <= iter->_end);
+  iter->_start = position;
+  iter->_pos = *pos;
   read_char(iter);
 }
 
@@ -216,6 +228,21 @@ void utf8iterator_next(Utf8Iterator* iter) {
   read_char(iter);
 }
 
+void utf8iterator_skip_ascii(Utf8Iterator* iter, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  update_position(iter);
+  iter->_start += iter->_width;
+  size_t rest = count - 1;
+  iter->_start += rest;
+  iter->_pos.offset += rest;
+  if (iter->_track_line_column) {
+    iter->_pos.column += rest;
+  }
+  read_char(iter);
+}
+
 int utf8iterator_current(const Utf8Iterator* iter) {
   return iter->_current;
 }
@@ -268,3 +295,107 @@ void utf8iterator_fill_error_at_mark(
   error->position = iter->_mark_pos;
   error->original_text = iter->_mark;
 }
+
+struct GumboInternalLineIndex {
+  const char* _buffer;
+  size_t _length;
+  int _tab_stop;
+
+  // Offsets of the first byte of each line, in increasing order; the first
+  // line starts at 0.
+  size_t* _line_starts;
+  size_t _line_count;
+  size_t _capacity;
+};
+
+static void add_line_start(GumboLineIndex* index, size_t start) {
+  if (index->_line_count == index->_capacity) {
+    index->_capacity *= 2;
+    index->_line_starts = gumbo_realloc(
+        index->_line_starts, index->_capacity * sizeof(size_t));
+  }
+  index->_line_starts[index->_line_count++] = start;
+}
+
+GumboLineIndex* gumbo_create_line_index(
+    const GumboOptions* options, const char* buffer, size_t length) {
+  GumboLineIndex* index = gumbo_malloc(sizeof(GumboLineIndex));
+  index->_buffer = buffer;
+  index->_length = length;
+  index->_tab_stop = options->tab_stop;
+  index->_capacity = 64;
+  index->_line_starts =
+      gumbo_malloc(index->_capacity * sizeof(size_t));
+  index->_line_count = 0;
+  add_line_start(index, 0);
+
+  const char* end = buffer + length;
+  if (!memchr(buffer, '\r', length)) {
+    // Only line feeds end lines, so the (vectorized) memchr can find them.
+    const char* p = buffer;
+    while ((p = memchr(p, '\n', end - p)) != NULL) {
+      ++p;
+      add_line_start(index, p - buffer);
+    }
+  } else {
+    // A carriage return ends a line unless it is part of a CR LF pair, in
+    // which case the line feed ends it, as in read_char.
+    for (const char* p = buffer; p < end; ++p) {
+      if (*p == '\n' || (*p == '\r' && (p + 1 == end || p[1] != '\n'))) {
+        add_line_start(index, p + 1 - buffer);
+      }
+    }
+  }
+  return index;
+}
+
+void gumbo_compute_position(
+    const GumboLineIndex* index, GumboSourcePosition* position) {
+  size_t offset = position->offset;
+  // Find the last line that starts at or before the offset.
+  size_t low = 0;
+  size_t high = index->_line_count;
+  while (high - low > 1) {
+    size_t middle = low + (high - low) / 2;
+    if (index->_line_starts[middle] <= offset) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  position->line = low + 1;
+
+  // Walk the line up to the offset with an iterator, so that columns count
+  // tabs and invalid UTF-8 exactly like the parser does.  Decoding errors are
+  // not recorded.
+  GumboOptions options = kGumboDefaultOptions;
+  options.tab_stop = index->_tab_stop;
+  options.max_errors = 0;
+  GumboOutput output;
+  output.errors = kGumboEmptyVector;
+  GumboParser parser;
+  parser._options = &options;
+  parser._output = &output;
+  parser._tokenizer_state = NULL;
+  parser._parser_state = NULL;
+
+  size_t line_start = index->_line_starts[low];
+  Utf8Iterator iter;
+  iter._start = index->_buffer + line_start;
+  iter._end = index->_buffer + index->_length;
+  iter._parser = &parser;
+  iter._track_line_column = true;
+  iter._pos.line = position->line;
+  iter._pos.column = 1;
+  iter._pos.offset = line_start;
+  read_char(&iter);
+  while (iter._pos.offset < offset && iter._current != -1) {
+    utf8iterator_next(&iter);
+  }
+  position->column = iter._pos.column;
+}
+
+void gumbo_destroy_line_index(GumboLineIndex* index) {
+  gumbo_free(index->_line_starts);
+  gumbo_free(index);
+}
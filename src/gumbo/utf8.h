@@ -73,6 +73,10 @@ typedef struct GumboInternalUtf8Iterator {
   // Pointer back to the GumboParser instance, for configuration options and
   // error recording.
   struct GumboInternalParser* _parser;
+
+  // Copy of the track_line_column option.  If false, only _pos.offset is
+  // updated.
+  bool _track_line_column;
 } Utf8Iterator;
 
 // Returns true if this Unicode code point is in the list of characters
@@ -85,9 +89,19 @@ void utf8iterator_init(
     struct GumboInternalParser* parser, const char* source,
     size_t source_length, Utf8Iterator* iter);
 
+// Moves the iterator to another position in its input, which must be the
+// start of a code point, with pos as its source position.
+void utf8iterator_seek(
+    Utf8Iterator* iter, const char* position, const GumboSourcePosition* pos);
+
 // Advances the current position by one code point.
 void utf8iterator_next(Utf8Iterator* iter);
 
+// Advances the current position by `count` code points, the same as calling
+// utf8iterator_next that many times.  All but the current code point must be
+// printable ASCII, so that each is a single byte and a single column.
+void utf8iterator_skip_ascii(Utf8Iterator* iter, size_t count);
+
 // Returns the current code point as an integer.
 int utf8iterator_current(const Utf8Iterator* iter);
 
@@ -48,27 +48,37 @@ void gumbo_memory_set_free(void (*free_p)(void *))
   gumbo_user_free = free_p ? free_p : free;
 }
 
-bool gumbo_isspace(unsigned char ch) 
-{
-  switch(ch) {
-    case ' ':
-    case '\f':
-    case '\r':
-    case '\n':
-    case '\t':
-      return true;
-    default:
-      return false;
-  }
-}
+#define SP GUMBO_CHAR_SPACE
+#define AL GUMBO_CHAR_ALPHA
+#define DG GUMBO_CHAR_DIGIT
+#define TN GUMBO_CHAR_TAG_NAME
+#define AN GUMBO_CHAR_ATTR_NAME
 
-bool gumbo_isalnum(unsigned char ch) 
-{
-  if ('a' <= ch && ch <= 'z') return true;
-  if ('A' <= ch && ch <= 'Z') return true;
-  if ('0' <= ch && ch <= '9') return true;
-  return false;
-}
+// Bytes from 0x80 up are left zero: they are never in any class.
+const unsigned char kGumboCharClass[256] = {
+  // 0x00
+  0, 0, 0, 0, 0, 0, 0, 0, 0, SP, SP, 0, SP, SP, 0, 0,
+  // 0x10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // 0x20  !"#$%&'()*+,-./
+  SP, TN|AN, TN, TN|AN, TN|AN, TN|AN, TN|AN, TN, TN|AN, TN|AN, TN|AN, TN|AN, TN|AN, TN|AN, TN|AN, 0,
+  // 0x30 0-9 :;<=>?
+  DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, DG|TN|AN, TN|AN, TN|AN, TN, TN, 0, TN|AN,
+  // 0x40 @A-O
+  TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN,
+  // 0x50 P-Z [\]^_
+  AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, TN|AN, TN|AN, TN|AN, TN|AN, TN|AN,
+  // 0x60 `a-o
+  TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN,
+  // 0x70 p-z {|}~ DEL
+  AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, AL|TN|AN, TN|AN, TN|AN, TN|AN, TN|AN, 0,
+};
+
+#undef SP
+#undef AL
+#undef DG
+#undef TN
+#undef AN
 
 // Debug function to trace operation of the parser.  Pass --copts=-DGUMBO_DEBUG
 // to use.
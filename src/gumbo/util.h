@@ -62,14 +62,46 @@ static inline int gumbo_tolower(int c)
   return c | ((c >= 'A' && c <= 'Z') << 5);
 }
 
+// Character classes of kGumboCharClass, shared by the tokenizer states.
+typedef enum {
+  // Whitespace as HTML defines it: tab, LF, FF, CR and space.
+  GUMBO_CHAR_SPACE = 1 << 0,
+  // ASCII letters.
+  GUMBO_CHAR_ALPHA = 1 << 1,
+  // ASCII digits.
+  GUMBO_CHAR_DIGIT = 1 << 2,
+  // Bytes that continue a tag name without special handling: printable
+  // ASCII other than '/' and '>'.
+  GUMBO_CHAR_TAG_NAME = 1 << 3,
+  // Bytes that continue an attribute name without special handling: like
+  // GUMBO_CHAR_TAG_NAME, minus '=' and the characters that are parse errors
+  // there.
+  GUMBO_CHAR_ATTR_NAME = 1 << 4
+} GumboCharClass;
+
+// Class bits of every byte, indexed by the byte value.
+extern const unsigned char kGumboCharClass[256];
+
+// True if c, a byte or a code point, is in any of the given classes.
+static inline bool gumbo_char_is(int c, unsigned char classes)
+{
+  return (unsigned int) c < 256 && (kGumboCharClass[c] & classes);
+}
+
 static inline bool gumbo_isalpha(int c)
 {
-  return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+  return gumbo_char_is(c, GUMBO_CHAR_ALPHA);
 }
 
-bool gumbo_isspace(unsigned char ch);
+static inline bool gumbo_isspace(unsigned char ch)
+{
+  return kGumboCharClass[ch] & GUMBO_CHAR_SPACE;
+}
 
-bool gumbo_isalnum(unsigned char ch);
+static inline bool gumbo_isalnum(unsigned char ch)
+{
+  return kGumboCharClass[ch] & (GUMBO_CHAR_ALPHA | GUMBO_CHAR_DIGIT);
+}
 
 // Debug wrapper for printf, to make it easier to turn off debugging info when
 // required.
@@ -40,8 +40,8 @@ void gumbo_vector_destroy(GumboVector* vector) {
 }
 
 static void enlarge_vector_if_full(GumboVector* vector, int space) {
-  unsigned int new_length = vector->length + space;
-  unsigned int new_capacity = vector->capacity;
+  size_t new_length = vector->length + space;
+  size_t new_capacity = vector->capacity;
 
   if (!new_capacity)
     new_capacity = 2;
@@ -79,8 +79,7 @@ int gumbo_vector_index_of(GumboVector* vector, const void* element) {
   return -1;
 }
 
-void gumbo_vector_insert_at(void* element, unsigned int index, GumboVector* vector) {
-  assert(index >= 0);
+void gumbo_vector_insert_at(void* element, size_t index, GumboVector* vector) {
   assert(index <= vector->length);
   enlarge_vector_if_full(vector, 1);
   ++vector->length;
@@ -108,8 +107,7 @@ void gumbo_vector_remove(const void* node, GumboVector* vector) {
   gumbo_vector_remove_at(index, vector);
 }
 
-void* gumbo_vector_remove_at(unsigned int index, GumboVector* vector) {
-  assert(index >= 0);
+void* gumbo_vector_remove_at(size_t index, GumboVector* vector) {
   assert(index < vector->length);
   void* result = vector->data[index];
   memmove(&vector->data[index], &vector->data[index + 1],
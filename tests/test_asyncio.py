@@ -0,0 +1,20 @@
+"""Test asyncio adapter"""
+
+import asyncio
+import gumbo
+from .fixtures import HTML
+
+
+def test_parse_async():
+    async def parse_all():
+        return await asyncio.gather(
+            gumbo.parse_async(HTML),
+            gumbo.parse_async(b'<p>Lorem ipsum', prune_tags=['p']),
+            gumbo.parse_async(HTML, timeout=0),
+            return_exceptions=True
+        )
+
+    output, pruned, error = asyncio.run(parse_all())
+    assert output.to_html() == gumbo.parse(HTML).to_html()
+    assert pruned.root.get_text() == ''
+    assert isinstance(error, TimeoutError)
@@ -1,5 +1,8 @@
 """Test Gumbo Python wrappers API"""
 
+import mmap
+import os
+
 from .fixtures import *
 
 
@@ -78,3 +81,486 @@ def test_comment(comment):
 def test_parse_fragment():
     output = gumbo.parse_fragment(b'<p>Lorem ipsum</p>')
     assert len(output.root.children) == 1
+
+
+def test_get_text():
+    output = gumbo.parse(b'<title>T</title><style>p {}</style><h1>Lorem  Ipsum</h1>'
+                         b'<p>a<b>b</b> c<br>d</p><script>var x;</script><!-- c -->')
+    assert output.document.get_text() == 'T Lorem Ipsum ab c d'
+    assert output.root.get_text(separator='\n') == 'T\nLorem Ipsum\nab c\nd'
+    assert output.root.get_text(skip=['title', 'h1']) == 'p {} ab c d var x;'
+    try:
+        output.root.get_text(skip=['foo'])
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised on an unknown tag!')
+
+
+def test_links():
+    output = gumbo.parse(b'<a href="a.html">a</a><base href="/dir/">'
+                         b'<img src="i.png" srcset="s1.png 1x, s2.png 2x">'
+                         b'<meta http-equiv="refresh" content="0; url=../next">'
+                         b'<script src="//cdn.example.com/x.js"></script>')
+    links = output.links('http://example.com/path/page.html')
+    assert [link[:4] for link in links] == [
+        ('a', 'href', 'a.html', 'http://example.com/dir/a.html'),
+        ('img', 'src', 'i.png', 'http://example.com/dir/i.png'),
+        ('img', 'srcset', 's1.png', 'http://example.com/dir/s1.png'),
+        ('img', 'srcset', 's2.png', 'http://example.com/dir/s2.png'),
+        ('meta', 'content', '../next', 'http://example.com/next'),
+        ('script', 'src', '//cdn.example.com/x.js', 'http://cdn.example.com/x.js'),
+    ]
+    assert links[0][4] == 8
+    assert output.links()[0] == ('a', 'href', 'a.html', None, 8)
+    # Attributes without a value are reported at their name
+    assert gumbo.parse(b'<p><a href>x</a><img SRC >').links() == [
+        ('a', 'href', '', None, 6), ('img', 'src', '', None, 21)]
+
+
+def test_to_html():
+    output = gumbo.parse(b'<!DOCTYPE html><title>a &amp; b</title><p class="a&quot;b">'
+                         b'x<br>y<img src=i.png></p><script>a < b</script>')
+    html = (b'<!DOCTYPE html><html><head><title>a &amp; b</title></head><body>'
+            b'<p class="a&quot;b">x<br>y<img src="i.png"></p><script>a < b</script></body></html>')
+    assert output.to_html() == html
+    assert gumbo.parse(html).to_html() == html
+    assert output.root.children[1].children[0].to_html() == b'<p class="a&quot;b">x<br>y<img src="i.png"></p>'
+    assert output.to_html(pretty=True).startswith(b'<!DOCTYPE html>\n<html>\n  <head>\n    <title>\n')
+
+
+def test_to_html_preserve():
+    html = b'<!doctype html>\n<P ID=x>Lorem <b>ipsum</b></P>\n<p class=\'y\'>dolor</p>\n'
+    output = gumbo.parse(html)
+    assert output.to_html(preserve=True) == html
+    body = output.root.children[1]
+    body.children[0].set_attribute('data-x', '1')
+    body.children[2].remove_attribute('class')
+    assert output.to_html(preserve=True) == (
+        b'<!doctype html>\n<p id="x" data-x="1">Lorem <b>ipsum</b></P>\n<p>dolor</p>\n')
+    try:
+        body.children[2].remove_attribute('class')
+    except KeyError:
+        pass
+    else:
+        raise AssertionError('KeyError is not raised on a missing attribute!')
+
+
+def test_to_html_preserve_children():
+    html = b'<title>t</title>\n<DIV><p>a</p></DIV><p class=b>b</p>\n'
+    output = gumbo.parse(html)
+    body = output.root.children[1]
+    body.insert_text('x < y')
+    assert output.to_html(preserve=True) == html + b'x &lt; y'
+    output.remove(body.children[1])
+    div = body.children[0]
+    div.insert_text('c', 0)
+    assert output.to_html(preserve=True) == b'<title>t</title>\n<DIV>c<p>a</p></DIV>\nx &lt; y'
+    output.remove(div)
+    assert output.to_html(preserve=True) == b'<title>t</title>\n\nx &lt; y'
+    assert div.children[0].text == 'c'
+    try:
+        output.remove(div)
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised on a removed node!')
+
+
+def test_parse_str():
+    output = gumbo.parse('<p>Lorem ipsum — dolor</p>')
+    assert output.root.children[1].children[0].children[0].text == 'Lorem ipsum — dolor'
+    assert gumbo.parse(bytearray(b'<p>x</p>')).to_html(preserve=True) == b'<p>x</p>'
+
+
+def test_rewriter():
+    rewriter = gumbo.Rewriter()
+    rewriter.set_attribute('a[href]', 'rel', 'nofollow')
+    rewriter.rewrite_attribute('a', 'href', lambda value: None if value == 'ad' else '/out?u=' + value)
+    rewriter.remove('div.ad, script')
+    rewriter.before('#main', '<!--main-->')
+    rewriter.after('li.x', '<li>new')
+    html = (b"<div id=main><A HREF='x.html'>x</A><a href=ad>y</a>"
+            b"<div class='ad big'><div>z</div><script>a('</div>')</script></div>"
+            b"<ul><li class=x>one<li>two</ul></div>")
+    assert rewriter.rewrite(html) == (
+        b'<!--main--><div id=main><A HREF="/out?u=x.html" rel="nofollow">x</A><a rel="nofollow">y</a>'
+        b'<ul><li class=x>one<li>new<li>two</ul></div>')
+    chunks = []
+    assert rewriter.rewrite(html.decode(), chunks.append) is None
+    assert b''.join(chunks) == rewriter.rewrite(html)
+    rewriter = gumbo.Rewriter()
+    rewriter.remove_attribute('a', 'onclick')
+    rewriter.set_attribute('a', 'href', '#')
+    # Duplicates that the tokenizer drops must not become the live attribute
+    assert rewriter.rewrite(b'<a onclick="x()" ONCLICK="evil()" href=x HRef=y OnClick>t</a>') == (
+        b'<a href="#">t</a>')
+    try:
+        rewriter.remove('div[')
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised on an invalid selector!')
+
+
+def test_tokenize():
+    tokens = list(gumbo.tokenize(b'<!DOCTYPE html><meta charset=utf-8><p>a &amp; b</p><!--c--><x-y>'))
+    assert tokens == [
+        (gumbo.GUMBO_TOKEN_DOCTYPE, None, 'html', None, None, 0),
+        (gumbo.GUMBO_TOKEN_START_TAG, gumbo.tag_enum('meta'), 'meta', [('charset', 'utf-8')], None, 15),
+        (gumbo.GUMBO_TOKEN_START_TAG, gumbo.tag_enum('p'), 'p', [], None, 35),
+        (gumbo.GUMBO_TOKEN_CHARACTER, None, None, None, 'a & b', 38),
+        (gumbo.GUMBO_TOKEN_END_TAG, gumbo.tag_enum('p'), 'p', None, None, 47),
+        (gumbo.GUMBO_TOKEN_COMMENT, None, None, None, 'c', 51),
+        (gumbo.GUMBO_TOKEN_START_TAG, gumbo.GUMBO_TAG_UNKNOWN, 'x-y', [], None, 59),
+    ]
+    assert gumbo.tag_name(gumbo.tag_enum('meta')) == 'meta'
+    assert [token[4] for token in gumbo.tokenize('<script>a<b</script>')][1] == 'a<b'
+
+
+def test_visitor():
+    class Visitor:
+        def __init__(self):
+            self.events = []
+
+        def start(self, tag):
+            self.events.append(('start', tag.tag_name))
+
+        def end(self, tag):
+            self.events.append(('end', tag.tag_name, tag.get_text()))
+
+    visitor = Visitor()
+    output = gumbo.parse(b'<title>T</title><p>a<b>b<p>c', visitor=visitor, visitor_tags=['title', 'p'])
+    assert visitor.events == [
+        ('start', 'title'), ('end', 'title', 'T'),
+        ('start', 'p'), ('end', 'p', 'ab'),
+        ('start', 'p'), ('end', 'p', 'c'),
+    ]
+    assert output.root.children[1].children[1].get_text() == 'c'
+
+    class Failing:
+        def end(self, tag):
+            raise RuntimeError(tag.tag_name)
+
+    try:
+        gumbo.parse(b'<p>x', visitor=Failing())
+    except RuntimeError as e:
+        assert str(e) == 'p'
+    else:
+        raise AssertionError('Visitor error is not raised!')
+
+
+def test_stop_after():
+    html = b'<title>T</title><link rel="canonical" href="/x"></head><body><p>Lorem ipsum</p>'
+    output = gumbo.parse(html, stop_after='head')
+    assert output.status == gumbo.GUMBO_STATUS_STOPPED
+    assert output.to_html() == b'<html><head><title>T</title><link rel="canonical" href="/x"></head><body></body></html>'
+    assert gumbo.parse(html).status == gumbo.GUMBO_STATUS_OK
+
+    class FirstTitle:
+        def end(self, tag):
+            return True
+
+    output = gumbo.parse(html, visitor=FirstTitle(), visitor_tags=['title'])
+    assert output.status == gumbo.GUMBO_STATUS_STOPPED
+    assert output.to_html() == b'<html><head><title>T</title></head><body></body></html>'
+
+
+def test_prune_tags():
+    html = b'<style>p {}</style><p>a<script>if (a<b) c = "</p>";</script>b<svg viewBox="0 0 1 1"><path d="M0 0"/><text>c</text></svg>d'
+    output = gumbo.parse(html, prune_tags=['script', 'style', 'svg'])
+    assert output.root.get_text() == 'a b d'
+    assert output.to_html() == (b'<html><head><style></style></head><body><p>a<script></script>b'
+                                b'<svg viewBox="0 0 1 1"></svg>d</p></body></html>')
+    output = gumbo.parse(b'<title>a</title><svg><title>b</title></svg>', prune_tags=['title'])
+    assert output.to_html() == b'<html><head><title></title></head><body><svg><title>b</title></svg></body></html>'
+    try:
+        gumbo.parse(html, prune_tags=['foo'])
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised on an unknown tag!')
+
+
+def test_drop_whitespace_and_comments():
+    html = b'<ul>\n  <li>a</li>\n  <!-- b -->\n  <li>c</li>\n</ul>'
+    ul = gumbo.parse(html, drop_whitespace=True, drop_comments=True).root.children[1].children[0]
+    assert [(node.tag_name, node.index_within_parent) for node in ul.children] == [('li', 0), ('li', 1)]
+    assert len(gumbo.parse(html).root.children[1].children[0].children) == 7
+    output = gumbo.parse(b'<p><b>x</b> <i>y</i>\n</p>\n<pre> <b>a</b>\n\n</pre>', drop_whitespace=True)
+    assert output.root.children[1].to_html() == b'<body><p><b>x</b> <i>y</i></p><pre> <b>a</b>\n\n</pre></body>'
+
+
+def test_limits():
+    def depth(node):
+        return 1 + max((depth(child) for child in node.children if isinstance(child, gumbo.TagNode)), default=0)
+
+    html = b'<div>' * 1000
+    output = gumbo.parse(html + b'<p>end</p>', max_tree_depth=100)
+    assert output.status == gumbo.GUMBO_STATUS_TREE_TOO_DEEP
+    # html, body and 98 nested divs; the deeper divs are flattened into siblings.
+    assert depth(output.root) == 100
+    assert output.to_html().count(b'<div>') == 1000
+    assert output.to_html().endswith(b'<p>end</p>' + b'</div>' * 97 + b'</body></html>')
+    assert gumbo.parse(html, max_nodes=50).status == gumbo.GUMBO_STATUS_TOO_MANY_NODES
+    # Length limits go past 2 GB, other limits are ints
+    assert gumbo.parse(html, max_text_length=1 << 40, max_attribute_length=1 << 40).status == (
+        gumbo.GUMBO_STATUS_OK)
+    for limits in ({'max_nodes': 1 << 31}, {'max_text_length': 1 << 63}, {'max_attributes': -1}):
+        try:
+            gumbo.parse(html, **limits)
+        except ValueError:
+            pass
+        else:
+            raise AssertionError('ValueError is not raised on %r!' % limits)
+    output = gumbo.parse(b'<a href="data:xyz" id=a title=b>Lorem ipsum</a>',
+                         max_text_length=5, max_attribute_length=4, max_attributes=2)
+    assert output.status == gumbo.GUMBO_STATUS_TRUNCATED
+    assert output.to_html() == b'<html><head></head><body><a href="data" id="a">Lorem</a></body></html>'
+    output = gumbo.parse(b'<table title="abcdef"><tr><td>x</td></tr></table>', max_attribute_length=4)
+    assert output.status == gumbo.GUMBO_STATUS_TRUNCATED
+    assert output.to_html() == (b'<html><head></head><body><table title="abcd"><tbody><tr><td>x</td></tr>'
+                                b'</tbody></table></body></html>')
+    assert gumbo.parse(html).status == gumbo.GUMBO_STATUS_OK
+
+
+def test_timeout():
+    html = b'<p>Lorem ipsum</p>' * 10000
+    try:
+        gumbo.parse(html, timeout=0)
+    except TimeoutError:
+        pass
+    else:
+        raise AssertionError('TimeoutError is not raised!')
+    assert gumbo.parse(html, timeout=60).status == gumbo.GUMBO_STATUS_OK
+    for timeout in (1e10, 1e300, float('inf')):
+        assert gumbo.parse(html, timeout=timeout).status == gumbo.GUMBO_STATUS_OK
+    for timeout in (-1, float('nan')):
+        try:
+            gumbo.parse(html, timeout=timeout)
+        except ValueError:
+            pass
+        else:
+            raise AssertionError('ValueError is not raised on timeout=%r!' % timeout)
+
+
+def test_parser():
+    parser = gumbo.Parser()
+    for i in range(3):
+        output = parser.parse_fragment('<li>{}</li>'.format(i), container='ul')
+        assert output.to_html() == '<html><li>{}</li></html>'.format(i).encode()
+    output = parser.parse_fragment(b'<circle r=1 />', container='svg', namespace='svg')
+    assert output.root.children[0].tag_namespace == gumbo.GUMBO_NAMESPACE_SVG
+    parser.reset()
+    assert parser.parse(b'<p>a').to_html() == gumbo.parse(b'<p>a').to_html()
+    try:
+        parser.parse_fragment(b'<p>a', namespace='foo')
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised!')
+
+
+def test_background_destroy():
+    gumbo.set_background_destroy(True)
+    try:
+        for _ in range(20):
+            output = gumbo.parse(b'<div><p>Lorem ipsum</p></div>' * 1000)
+            assert output.status == gumbo.GUMBO_STATUS_OK
+            del output
+    finally:
+        gumbo.set_background_destroy(False)
+    assert gumbo.parse(b'<p>a').root.children[1].children[0].tag_name == 'p'
+
+
+def test_encoding():
+    html = '<meta charset="windows-1252"><p>Caf\xe9 €</p>'
+    assert gumbo.parse(html.encode('cp1252')).root.get_text() == 'Caf\xe9 €'
+    assert gumbo.parse(html.encode('utf-16')).root.get_text() == 'Caf\xe9 €'
+    assert gumbo.parse(b'\xef\xbb\xbf<p>a').root.children[1].children[0].tag_name == 'p'
+    html = '<meta charset="koi8-r"><p>Привет</p>'
+    assert gumbo.parse(html.encode('koi8_r')).root.get_text() == 'Привет'
+    assert gumbo.parse('<p>Łódź</p>'.encode('iso8859_2'), encoding='latin2').root.get_text() == 'Łódź'
+    html = '<p>日本語</p>'
+    assert gumbo.parse(html.encode('shift_jis'), transport_encoding='Shift_JIS').root.get_text() == '日本語'
+    assert gumbo.parse(html.encode('euc-kr'), encoding='euc-kr').root.get_text() == '日本語'
+    try:
+        gumbo.parse(b'<p>a', encoding='foo')
+    except LookupError:
+        pass
+    else:
+        raise AssertionError('LookupError is not raised!')
+
+
+def test_escape_and_unescape():
+    s = 'Lorem ipsum'
+    assert gumbo.escape(s) is s
+    assert gumbo.unescape(s) is s
+    assert gumbo.escape('<a href="x">\'&\'</a>') == '&lt;a href=&quot;x&quot;&gt;&#x27;&amp;&#x27;&lt;/a&gt;'
+    assert gumbo.escape('"\'', quote=False) == '"\''
+    assert gumbo.unescape('&lt;p&gt; &amp &notit; &#x80; &#65 &nGt; &foo; &') == '<p> & ¬it; € A ≫⃒ &foo; &'
+
+
+def test_position():
+    output = gumbo.parse(b'<p>a</p>\n\t<div>b</div>')
+    div = output.root.children[1].children[2]
+    assert div.tag_name == 'div'
+    assert output.position(div.offset) == (2, 4)
+    assert output.position(0) == (1, 1)
+    # Offsets are size_t, so this one is out of range rather than wrapped to 1
+    try:
+        output.position((1 << 32) + 1)
+    except ValueError as e:
+        assert str(e) == 'offset is out of range: 4294967297'
+    else:
+        raise AssertionError('ValueError is not raised on an offset past the end!')
+
+
+def test_parse_mmap(tmp_path):
+    path = tmp_path / 'mmap.html'
+    path.write_bytes(b'<p id=x>y</p>')
+    with open(path, 'rb') as f:
+        source = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    output = gumbo.parse(source)
+    assert output.root.children[1].children[0].children[0].offset == 8
+    assert output.to_html(preserve=True) == b'<p id=x>y</p>'
+    # Read-only buffers are parsed in place, so the tree holds an export of the map
+    try:
+        source.close()
+    except BufferError:
+        pass
+    else:
+        raise AssertionError('BufferError is not raised on closing a parsed mmap!')
+    del output
+    source.close()
+
+
+def test_mixed_case_names():
+    output = gumbo.parse(b'<DiV DATA-Foo=1 Class=x><sVg ViewBox="0 0 1 1"></SVG></dIv>')
+    div = output.root.children[1].children[0]
+    assert div.tag_name == 'div'
+    assert div.attributes.as_dict() == {'data-foo': '1', 'class': 'x'}
+    svg = div.children[0]
+    assert svg.tag_namespace == gumbo.GUMBO_NAMESPACE_SVG
+    assert 'viewBox' in svg.attributes
+    output = gumbo.parse(b'<p LongAttributeName=1>', max_attribute_length=4)
+    assert output.status == gumbo.GUMBO_STATUS_TRUNCATED
+    assert output.to_html() == b'<html><head></head><body><p long="1"></p></body></html>'
+
+
+def test_duplicate_attribute_after_max_errors():
+    # Errors are no longer recorded after the default max_errors of 50
+    output = gumbo.parse(b'</x>' * 60 + b'<p a a b>')
+    assert output.root.children[1].children[0].attributes.as_dict() == {'a': '', 'b': ''}
+
+
+def test_pipeline():
+    html = (b'<title>a<b></title><svg><title><![CDATA[x]]></title><![CDATA[y]]></svg>'
+            b'<select><textarea>c<d</textarea></select><script>e<!--f--></script>') * 200
+    # Pipelining is skipped on a single core unless parse is told otherwise
+    gumbo.set_cpu_count(2)
+    try:
+        assert gumbo.parse(html, pipeline=True).to_html() == gumbo.parse(html).to_html()
+        # The lexer thread can't know when max_errors is reached, so tokens must not depend on it
+        output = gumbo.parse(b'</x>' * 60 + b'<p a a b>', pipeline=True)
+        assert output.root.children[1].children[0].attributes.as_dict() == {'a': '', 'b': ''}
+    finally:
+        gumbo.set_cpu_count(0)
+
+
+def test_chunk_size():
+    html = (b'<p>a &amp; b</p>\n<script>if (a > b) x = "<p>";</script>\n<!-- c >\nd -->\n'
+            b'<svg><title>t</title><![CDATA[<x>]]></svg>\n<textarea>\n<e></textarea>\n') * 300
+    serial = gumbo.parse(html)
+    gumbo.set_cpu_count(2)
+    try:
+        chunked = gumbo.parse(html, chunk_size=64)
+    finally:
+        gumbo.set_cpu_count(0)
+    assert chunked.to_html() == serial.to_html()
+    body = chunked.root.children[1]
+    assert [node.offset for node in body.children] == [node.offset for node in serial.root.children[1].children]
+
+
+def test_evict_tags():
+    class Rows:
+        def __init__(self):
+            self.rows = []
+
+        def end(self, tag):
+            self.rows.append([cell.get_text() for cell in tag.children])
+
+    html = b'<table>\n' + b''.join(b'<tr><td>%d<td><b>x</b></tr>\n' % i for i in range(1000)) + b'</table><p>end'
+    visitor = Rows()
+    output = gumbo.parse(html, visitor=visitor, visitor_tags=['tr'], evict_tags=['tr'], drop_whitespace=True)
+    assert visitor.rows == [[str(i), 'x'] for i in range(1000)]
+    assert output.to_html() == b'<html><head></head><body><table><tbody></tbody></table><p>end</p></body></html>'
+    try:
+        gumbo.parse(html, evict_tags=['tr'])
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised without a visitor!')
+    for visitor_tags, evict_tags in ((['td'], ['tr']), (['tr'], ['tr', 'td'])):
+        try:
+            gumbo.parse(html, visitor=visitor, visitor_tags=visitor_tags, evict_tags=evict_tags)
+        except ValueError:
+            pass
+        else:
+            raise AssertionError('ValueError is not raised for tags the visitor does not get!')
+    try:
+        gumbo.parse(html, visitor=object(), evict_tags=['tr'])
+    except ValueError:
+        pass
+    else:
+        raise AssertionError('ValueError is not raised for a visitor without end!')
+
+
+def test_evicted_nodes():
+    class Rows:
+        def __init__(self):
+            self.rows = []
+            self.cells = []
+
+        def start(self, tag):
+            if tag.tag_name == 'td':
+                self.cells.append(tag)
+            elif tag.tag_name == 'table':
+                self.table = tag
+
+        def end(self, tag):
+            if tag.tag_name == 'tr':
+                self.rows.append(tag)
+                assert tag.children[0].get_text() == '1'
+
+    visitor = Rows()
+    output = gumbo.parse(b'<table><tr><td>1</tr><tr><td>1</tr></table>', visitor=visitor,
+                         visitor_tags=['table', 'tr', 'td'], evict_tags=['tr'])
+    assert output.to_html() == b'<html><head></head><body><table><tbody></tbody></table></body></html>'
+    assert len(visitor.rows) == 2
+    for node in visitor.rows + visitor.cells:
+        try:
+            node.children
+        except ValueError:
+            pass
+        else:
+            raise AssertionError('ValueError is not raised on an evicted node!')
+    assert len(visitor.table.children[0].children) == 0
+
+
+@pytest.mark.skipif(not os.environ.get('GUMBO_LARGE_TESTS'), reason='parses over 4 GB of input')
+def test_large_offsets(tmp_path):
+    # NULs in the sparse file are dropped from the body, so the tree stays small
+    filler_length = (1 << 32) + 5
+    with open(tmp_path / 'large.html', 'wb+') as f:
+        f.seek(filler_length - 1)
+        f.write(b'\n<p id=x>y</p>')
+        f.flush()
+        with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as source:
+            output = gumbo.parse(source)
+            p = output.root.children[1].children[1]
+            assert p.tag_name == 'p'
+            assert p.offset == filler_length
+            assert p.children[0].offset == filler_length + 8
+            assert output.position(p.offset) == (2, 1)
+            del output, p